@@ -3,6 +3,222 @@
 #include <vector>
 #include <random>
 #include <iomanip>
+#include <fstream>
+#include <filesystem>
+#include <string>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <algorithm>
+#include <functional>
+#include <type_traits>
+#include <list>
+#include <unordered_map>
+#include <thread>
+#include <cstdlib>
+#include <cmath>
+#include <cerrno>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <climits>
+#include <new>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+#if defined(__GNUC__) && defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
+#if defined(__unix__)
+#include <fcntl.h>
+#include <pthread.h>
+#include <sched.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+#if defined(__linux__)
+#include <sys/prctl.h>
+#endif
+
+/**
+ * Number of worker threads used by the parallel routines.
+ * Falls back to 1 when the hardware concurrency is unknown.
+ */
+int defaultThreadCount() {
+    unsigned hw = std::thread::hardware_concurrency();
+    return hw > 0 ? static_cast<int>(hw) : 1;
+}
+
+/**
+ * Parallel Loop over a Range
+ * Time Complexity: O(work / threads)
+ * Space Complexity: O(threads)
+ * 
+ * Algorithm Steps:
+ * 1. Split [begin, end) into one contiguous chunk per thread
+ * 2. Run body(chunkBegin, chunkEnd) on each chunk, the last one on the caller
+ * 3. Join all threads
+ * 
+ * The split depends only on the range and the thread count, so routines
+ * that partition rows through parallelFor always hand the same rows to the
+ * same thread index.
+ */
+void parallelFor(int begin, int end, const std::function<void(int, int)>& body, int numThreads = 0) {
+    if (numThreads <= 0) numThreads = defaultThreadCount();
+    numThreads = std::max(1, std::min(numThreads, end - begin));
+    if (numThreads == 1) {
+        if (begin < end) body(begin, end);
+        return;
+    }
+    std::vector<std::thread> threads;
+    threads.reserve(numThreads - 1);
+    const long long count = end - begin;
+    for (int t = 0; t < numThreads - 1; t++) {
+        int chunkBegin = begin + static_cast<int>(count * t / numThreads);
+        int chunkEnd = begin + static_cast<int>(count * (t + 1) / numThreads);
+        threads.emplace_back(body, chunkBegin, chunkEnd);
+    }
+    body(begin + static_cast<int>(count * (numThreads - 1) / numThreads), end);
+    for (std::thread& thread : threads) thread.join();
+}
+
+/**
+ * How the element block of a matrix was obtained:
+ * - Heap: aligned operator new (small matrices, or no huge page support)
+ * - HugePages: explicit 2 MB pages from the hugetlbfs pool (MAP_HUGETLB)
+ * - TransparentHugePages: 2 MB aligned memory advised with MADV_HUGEPAGE
+ */
+enum class MatrixAllocationKind { Heap, HugePages, TransparentHugePages };
+
+// Stored just in front of the row pointer table so freeMatrix needs no size
+struct MatrixBlockHeader {
+    void* data;
+    size_t bytes;
+    MatrixAllocationKind kind;
+};
+
+const size_t HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+const size_t MATRIX_ALIGNMENT = 64;
+
+MatrixBlockHeader* matrixBlockHeader(long long** matrix) {
+    return reinterpret_cast<MatrixBlockHeader*>(reinterpret_cast<char*>(matrix) - sizeof(MatrixBlockHeader));
+}
+
+MatrixAllocationKind matrixAllocationKind(long long** matrix) {
+    return matrixBlockHeader(matrix)->kind;
+}
+
+/**
+ * Allocate the element block, preferring huge pages for large matrices.
+ * Falls back from explicit huge pages to transparent huge pages to the
+ * ordinary heap, so the call succeeds whenever the memory exists.
+ */
+long long* allocateMatrixData(size_t bytes, MatrixBlockHeader& header) {
+#if defined(__linux__)
+    if (bytes >= HUGE_PAGE_SIZE) {
+        size_t rounded = (bytes + HUGE_PAGE_SIZE - 1) / HUGE_PAGE_SIZE * HUGE_PAGE_SIZE;
+        void* data = mmap(nullptr, rounded, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (data != MAP_FAILED) {
+            header = {data, rounded, MatrixAllocationKind::HugePages};
+            return static_cast<long long*>(data);
+        }
+        data = nullptr;
+        if (posix_memalign(&data, HUGE_PAGE_SIZE, rounded) == 0) {
+            madvise(data, rounded, MADV_HUGEPAGE);
+            header = {data, rounded, MatrixAllocationKind::TransparentHugePages};
+            return static_cast<long long*>(data);
+        }
+    }
+#endif
+    void* data = ::operator new(bytes > 0 ? bytes : 1, std::align_val_t(MATRIX_ALIGNMENT));
+    header = {data, bytes, MatrixAllocationKind::Heap};
+    return static_cast<long long*>(data);
+}
+
+/**
+ * NUMA-Aware Contiguous Matrix Allocation
+ * Time Complexity: O(rows × cols / threads) for large matrices, O(rows) otherwise
+ * Space Complexity: O(rows × cols)
+ * 
+ * Algorithm Steps:
+ * 1. Allocate one element block, on 2 MB huge pages when the matrix is
+ *    at least one huge page (explicit pages first, then transparent ones)
+ * 2. Allocate the row pointer table behind a small header describing the block
+ * 3. For huge-page blocks, first-touch the rows in parallel with the same
+ *    parallelFor partitioning the compute routines use, so each page is
+ *    placed on the NUMA node of the thread that will work on those rows
+ * 
+ * Memory Optimization:
+ * - Two allocations instead of one per row
+ * - Huge pages cut TLB misses on large operands
+ * - First-touch placement avoids cross-socket traffic on multi-socket hosts
+ * - 64-byte aligned rows start on cache line boundaries when cols allows it
+ * - Release with freeMatrix
+ */
+long long** allocateMatrix(int rows, int cols, int numThreads = 0) {
+    char* table = new char[sizeof(MatrixBlockHeader) + sizeof(long long*) * (rows > 0 ? rows : 1)];
+    long long** matrix = reinterpret_cast<long long**>(table + sizeof(MatrixBlockHeader));
+    MatrixBlockHeader& header = *matrixBlockHeader(matrix);
+    long long* data = allocateMatrixData(static_cast<size_t>(rows) * cols * sizeof(long long), header);
+    matrix[0] = data;
+    for (int i = 1; i < rows; i++) {
+        matrix[i] = data + static_cast<size_t>(i) * cols;
+    }
+    if (header.kind != MatrixAllocationKind::Heap) {
+        parallelFor(0, rows, [&](int rowBegin, int rowEnd) {
+            std::memset(matrix[rowBegin], 0, static_cast<size_t>(rowEnd - rowBegin) * cols * sizeof(long long));
+        }, numThreads);
+    }
+    return matrix;
+}
+
+long long** allocateMatrix(int n) {
+    return allocateMatrix(n, n);
+}
+
+void freeMatrix(long long** matrix) {
+    MatrixBlockHeader* header = matrixBlockHeader(matrix);
+    switch (header->kind) {
+#if defined(__linux__)
+        case MatrixAllocationKind::HugePages:
+            munmap(header->data, header->bytes);
+            break;
+        case MatrixAllocationKind::TransparentHugePages:
+            free(header->data);
+            break;
+#endif
+        default:
+            ::operator delete(header->data, std::align_val_t(MATRIX_ALIGNMENT));
+            break;
+    }
+    delete[] reinterpret_cast<char*>(header);
+}
+
+/**
+ * GEMM-Style Accumulation
+ * Every dense engine computes C = alpha × A × B + beta × C, with
+ * alpha = 1 and beta = 0 (a plain product) by default. With beta = 0 the
+ * old contents of C are never read, so C may start uninitialized.
+ */
+inline void storeScaled(long long& c, long long product, long long alpha, long long beta) {
+    c = beta == 0 ? alpha * product : alpha * product + beta * c;
+}
+
+/**
+ * Scale row[begin..end) by beta ahead of a kernel that adds into it.
+ */
+inline void scaleRow(long long* row, int begin, int end, long long beta) {
+    if (beta == 0) {
+        std::fill(row + begin, row + end, 0LL);
+    } else if (beta != 1) {
+        for (int j = begin; j < end; j++) row[j] *= beta;
+    }
+}
 
 /**
  * Optimized Brute Force Matrix Multiplication
@@ -10,11 +226,12 @@
  * Space Complexity: O(n²)
  * 
  * Algorithm Steps:
- * 1. Initialize result matrix C with zeros
- * 2. For each element in C:
+ * 1. For each element in C:
  *    a. Calculate dot product of row i from A and column j from B
- *    b. Store result in C[i][j]
- * 3. Use early termination for zero elements
+ *    b. Store alpha × dot + beta × C[i][j] in C[i][j]
+ * 
+ * Zeros are not special-cased: a per-element branch costs more than the
+ * multiply it skips on dense data; sparse inputs belong in csrDenseMultiply.
  * 
  * Memory Optimization:
  * - In-place matrix multiplication
@@ -22,15 +239,14 @@
  * - Efficient memory access patterns
  * - Direct array indexing
  */
-void matrixMultiplyBruteForce(long long** A, long long** B, long long** C, int n) {
+void matrixMultiplyBruteForce(long long** A, long long** B, long long** C, int n, long long alpha = 1, long long beta = 0) {
     for (int i = 0; i < n; i++) {
         for (int j = 0; j < n; j++) {
-            C[i][j] = 0;
+            long long sum = 0;
             for (int k = 0; k < n; k++) {
-                if (A[i][k] != 0 && B[k][j] != 0) {  // Skip multiplication if either element is 0
-                    C[i][j] += A[i][k] * B[k][j];
-                }
+                sum += A[i][k] * B[k][j];
             }
+            storeScaled(C[i][j], sum, alpha, beta);
         }
     }
 }
@@ -82,32 +298,137 @@ void subtractMatrix(long long** A, long long** B, long long** C, int n) {
 }
 
 /**
- * Initialize matrix with random values
- * Time Complexity: O(n²)
+ * SplitMix64 Finalizer
+ * Time Complexity: O(1)
+ * Space Complexity: O(1)
+ * 
+ * Bijective 64-bit mixing function; consecutive inputs give statistically
+ * independent outputs, which is what makes counter-based generation work.
+ */
+unsigned long long splitMix64(unsigned long long x) {
+    x += 0x9E3779B97F4A7C15ULL;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+    return x ^ (x >> 31);
+}
+
+/**
+ * Counter-Based Random Number
+ * Time Complexity: O(1)
+ * Space Complexity: O(1)
+ * 
+ * Returns the counter-th value of the stream selected by seed. There is no
+ * generator state: any element can be produced independently, in any
+ * order, on any thread, and always gets the same value.
+ */
+unsigned long long counterRandom(unsigned long long seed, unsigned long long counter) {
+    return splitMix64(splitMix64(seed) ^ (counter * 0xD1B54A32D192ED03ULL));
+}
+
+/**
+ * Map 64 random bits onto [minValue, maxValue] with a multiply-shift,
+ * which avoids the division of a modulo reduction.
+ */
+long long randomInRange(unsigned long long bits, long long minValue, long long maxValue) {
+    unsigned long long span = static_cast<unsigned long long>(maxValue - minValue) + 1;
+    if (span == 0) return static_cast<long long>(bits);  // Full 64-bit range
+#if defined(__SIZEOF_INT128__)
+    unsigned long long offset = static_cast<unsigned long long>((static_cast<unsigned __int128>(bits) * span) >> 64);
+#else
+    unsigned long long offset = bits % span;
+#endif
+    return minValue + static_cast<long long>(offset);
+}
+
+/**
+ * Parallel Deterministic Matrix Fill
+ * Time Complexity: O(rows × cols / threads)
+ * Space Complexity: O(1)
+ * 
+ * Algorithm Steps:
+ * 1. Split the rows into contiguous blocks through parallelFor
+ * 2. Each thread writes value(i, j) for every element of its block
+ * 
+ * value must depend only on (i, j), so the matrix is identical for every
+ * thread count.
+ */
+template <typename ValueFunction>
+void fillMatrixParallel(long long** matrix, int rows, int cols, ValueFunction value, int numThreads = 0) {
+    parallelFor(0, rows, [&](int rowBegin, int rowEnd) {
+        for (int i = rowBegin; i < rowEnd; i++) {
+            long long* row = matrix[i];
+            for (int j = 0; j < cols; j++) {
+                row[j] = value(i, j);
+            }
+        }
+    }, numThreads);
+}
+
+/**
+ * Initialize matrix with reproducible random values
+ * Time Complexity: O(n² / threads)
  * Space Complexity: O(1)
  * 
  * Algorithm Steps:
- * 1. Create random number generator with seed
- * 2. Create uniform distribution for random numbers
- * 3. Fill matrix with random values in range [1, 10] to prevent overflow
+ * 1. Give element (i, j) the counter i × n + j in the stream of seed
+ * 2. Map its random bits into [minValue, maxValue]
+ * 3. Fill row blocks in parallel
  * 
  * Memory Optimization:
  * - In-place initialization
- * - No temporary arrays
- * - Efficient random number generation
+ * - No generator state shared between threads
+ * - Default range [1, 10] prevents overflow; negative bounds give signed matrices
  */
-void initializeRandomMatrix(long long** matrix, int n) {
-    // Create random number generator
-    std::random_device rd;
-    std::mt19937 gen(rd());
-    std::uniform_int_distribution<> dis(1, 10);  // Reduced range to prevent overflow
-    
-    // Fill matrix with random values
-    for (int i = 0; i < n; i++) {
-        for (int j = 0; j < n; j++) {
-            matrix[i][j] = dis(gen);
-        }
-    }
+void initializeRandomMatrix(long long** matrix, int n, unsigned long long seed,
+                            long long minValue = 1, long long maxValue = 10, int numThreads = 0) {
+    fillMatrixParallel(matrix, n, n, [=](int i, int j) {
+        return randomInRange(counterRandom(seed, static_cast<unsigned long long>(i) * n + j), minValue, maxValue);
+    }, numThreads);
+}
+
+/**
+ * Initialize sparse matrix with reproducible random values
+ * Time Complexity: O(n² / threads)
+ * Space Complexity: O(1)
+ * 
+ * Each element is nonzero with probability density, decided by one counter
+ * and valued from a second, independent counter.
+ */
+void initializeSparseMatrix(long long** matrix, int n, unsigned long long seed, double density,
+                            long long minValue = 1, long long maxValue = 10, int numThreads = 0) {
+    const unsigned long long threshold = density >= 1.0 ? ~0ULL
+        : static_cast<unsigned long long>(std::max(0.0, density) * 18446744073709551616.0);
+    fillMatrixParallel(matrix, n, n, [=](int i, int j) {
+        unsigned long long index = static_cast<unsigned long long>(i) * n + j;
+        if (counterRandom(seed, 2 * index) >= threshold) return 0LL;
+        return randomInRange(counterRandom(seed, 2 * index + 1), minValue, maxValue);
+    }, numThreads);
+}
+
+/**
+ * Initialize banded matrix with reproducible random values
+ * Time Complexity: O(n² / threads)
+ * Space Complexity: O(1)
+ * 
+ * Elements with |i - j| ≤ bandwidth are random, all others are zero.
+ */
+void initializeBandedMatrix(long long** matrix, int n, unsigned long long seed, int bandwidth,
+                            long long minValue = 1, long long maxValue = 10, int numThreads = 0) {
+    fillMatrixParallel(matrix, n, n, [=](int i, int j) {
+        if (std::abs(i - j) > bandwidth) return 0LL;
+        return randomInRange(counterRandom(seed, static_cast<unsigned long long>(i) * n + j), minValue, maxValue);
+    }, numThreads);
+}
+
+/**
+ * Initialize identity matrix
+ * Time Complexity: O(n² / threads)
+ * Space Complexity: O(1)
+ */
+void initializeIdentityMatrix(long long** matrix, int n, int numThreads = 0) {
+    fillMatrixParallel(matrix, n, n, [](int i, int j) {
+        return i == j ? 1LL : 0LL;
+    }, numThreads);
 }
 
 /**
@@ -127,34 +448,23 @@ void initializeRandomMatrix(long long** matrix, int n) {
  * - Proper cleanup of allocated memory
  * - Static allocation for small matrices
  */
-void matrixMultiplyDivideConquer(long long** A, long long** B, long long** C, int n) {
+void matrixMultiplyDivideConquer(long long** A, long long** B, long long** C, int n, long long alpha = 1, long long beta = 0) {
     if (n <= 2) {
-        matrixMultiplyBruteForce(A, B, C, n);
+        matrixMultiplyBruteForce(A, B, C, n, alpha, beta);
         return;
     }
     
     int half = n / 2;
     
     // Allocate submatrices
-    long long** A11 = new long long*[half];
-    long long** A12 = new long long*[half];
-    long long** A21 = new long long*[half];
-    long long** A22 = new long long*[half];
-    long long** B11 = new long long*[half];
-    long long** B12 = new long long*[half];
-    long long** B21 = new long long*[half];
-    long long** B22 = new long long*[half];
-    
-    for (int i = 0; i < half; i++) {
-        A11[i] = new long long[half];
-        A12[i] = new long long[half];
-        A21[i] = new long long[half];
-        A22[i] = new long long[half];
-        B11[i] = new long long[half];
-        B12[i] = new long long[half];
-        B21[i] = new long long[half];
-        B22[i] = new long long[half];
-    }
+    long long** A11 = allocateMatrix(half);
+    long long** A12 = allocateMatrix(half);
+    long long** A21 = allocateMatrix(half);
+    long long** A22 = allocateMatrix(half);
+    long long** B11 = allocateMatrix(half);
+    long long** B12 = allocateMatrix(half);
+    long long** B21 = allocateMatrix(half);
+    long long** B22 = allocateMatrix(half);
     
     // Split matrices
     for (int i = 0; i < half; i++) {
@@ -171,27 +481,15 @@ void matrixMultiplyDivideConquer(long long** A, long long** B, long long** C, in
     }
     
     // Allocate temporary matrices for Strassen's formulas
-    long long** temp1 = new long long*[half];
-    long long** temp2 = new long long*[half];
-    long long** P1 = new long long*[half];
-    long long** P2 = new long long*[half];
-    long long** P3 = new long long*[half];
-    long long** P4 = new long long*[half];
-    long long** P5 = new long long*[half];
-    long long** P6 = new long long*[half];
-    long long** P7 = new long long*[half];
-    
-    for (int i = 0; i < half; i++) {
-        temp1[i] = new long long[half];
-        temp2[i] = new long long[half];
-        P1[i] = new long long[half];
-        P2[i] = new long long[half];
-        P3[i] = new long long[half];
-        P4[i] = new long long[half];
-        P5[i] = new long long[half];
-        P6[i] = new long long[half];
-        P7[i] = new long long[half];
-    }
+    long long** temp1 = allocateMatrix(half);
+    long long** temp2 = allocateMatrix(half);
+    long long** P1 = allocateMatrix(half);
+    long long** P2 = allocateMatrix(half);
+    long long** P3 = allocateMatrix(half);
+    long long** P4 = allocateMatrix(half);
+    long long** P5 = allocateMatrix(half);
+    long long** P6 = allocateMatrix(half);
+    long long** P7 = allocateMatrix(half);
     
     // Calculate P1 to P7 using Strassen's formulas
     subtractMatrix(B12, B22, temp1, half);
@@ -218,29 +516,22 @@ void matrixMultiplyDivideConquer(long long** A, long long** B, long long** C, in
     addMatrix(B11, B12, temp2, half);
     matrixMultiplyDivideConquer(temp1, temp2, P7, half);
     
-    // Combine results
+    // Combine results; only this level applies alpha and beta
     for (int i = 0; i < half; i++) {
         for (int j = 0; j < half; j++) {
-            C[i][j] = P5[i][j] + P4[i][j] - P2[i][j] + P6[i][j];
-            C[i][j + half] = P1[i][j] + P2[i][j];
-            C[i + half][j] = P3[i][j] + P4[i][j];
-            C[i + half][j + half] = P5[i][j] + P1[i][j] - P3[i][j] - P7[i][j];
+            storeScaled(C[i][j], P5[i][j] + P4[i][j] - P2[i][j] + P6[i][j], alpha, beta);
+            storeScaled(C[i][j + half], P1[i][j] + P2[i][j], alpha, beta);
+            storeScaled(C[i + half][j], P3[i][j] + P4[i][j], alpha, beta);
+            storeScaled(C[i + half][j + half], P5[i][j] + P1[i][j] - P3[i][j] - P7[i][j], alpha, beta);
         }
     }
     
     // Clean up allocated memory
-    for (int i = 0; i < half; i++) {
-        delete[] A11[i]; delete[] A12[i]; delete[] A21[i]; delete[] A22[i];
-        delete[] B11[i]; delete[] B12[i]; delete[] B21[i]; delete[] B22[i];
-        delete[] temp1[i]; delete[] temp2[i];
-        delete[] P1[i]; delete[] P2[i]; delete[] P3[i]; delete[] P4[i];
-        delete[] P5[i]; delete[] P6[i]; delete[] P7[i];
-    }
-    delete[] A11; delete[] A12; delete[] A21; delete[] A22;
-    delete[] B11; delete[] B12; delete[] B21; delete[] B22;
-    delete[] temp1; delete[] temp2;
-    delete[] P1; delete[] P2; delete[] P3; delete[] P4;
-    delete[] P5; delete[] P6; delete[] P7;
+    freeMatrix(A11); freeMatrix(A12); freeMatrix(A21); freeMatrix(A22);
+    freeMatrix(B11); freeMatrix(B12); freeMatrix(B21); freeMatrix(B22);
+    freeMatrix(temp1); freeMatrix(temp2);
+    freeMatrix(P1); freeMatrix(P2); freeMatrix(P3); freeMatrix(P4);
+    freeMatrix(P5); freeMatrix(P6); freeMatrix(P7);
 }
 
 /**
@@ -267,82 +558,7421 @@ bool verifyMatrices(long long** A, long long** B, int n) {
     return true;
 }
 
-int main() {
-    std::cout << "Testing Matrix Multiplication Algorithms" << std::endl << std::endl;
-    
-    // Test with different matrix sizes
-    const int testSizes[] = {2, 4, 8, 128};
-    const int numTests = sizeof(testSizes) / sizeof(testSizes[0]);
-    const int NUM_ITERATIONS = 10; // Run each test multiple times
-    
-    for (int i = 0; i < numTests; i++) {
-        const int n = testSizes[i];
-        std::cout << std::endl << "Test Case " << (i + 1) << ": " << n << "x" << n << " matrices" << std::endl;
-        
-        // Allocate matrices
-        long long** A = new long long*[n];
-        long long** B = new long long*[n];
-        long long** C1 = new long long*[n];
-        long long** C2 = new long long*[n];
-        
-        for (int j = 0; j < n; j++) {
-            A[j] = new long long[n];
-            B[j] = new long long[n];
-            C1[j] = new long long[n];
-            C2[j] = new long long[n];
+const int TRANSPOSE_LEAF = 32;
+
+/**
+ * Cache-Oblivious Transpose Traversal
+ * Time Complexity: O(rows × cols)
+ * Space Complexity: O(log(rows × cols)) recursion depth
+ * 
+ * Visits src[r0..r1)[c0..c1) by halving the longer side until a block of at
+ * most TRANSPOSE_LEAF × TRANSPOSE_LEAF remains, and hands every element to
+ * store(col, row, value). At every cache level some recursion depth yields
+ * blocks whose source rows and destination rows both fit, so reads and
+ * transposed writes miss O(rows × cols / line) times without knowing the
+ * cache sizes.
+ */
+template <typename Store>
+void transposeRecursive(long long** src, int r0, int r1, int c0, int c1, Store& store) {
+    if (r1 - r0 <= TRANSPOSE_LEAF && c1 - c0 <= TRANSPOSE_LEAF) {
+        for (int c = c0; c < c1; c++) {
+            for (int r = r0; r < r1; r++) store(c, r, src[r][c]);
         }
-        
-        // Initialize test matrices with random values
-        initializeRandomMatrix(A, n);
-        initializeRandomMatrix(B, n);
-        
-        // Measure brute force
-        auto start = std::chrono::high_resolution_clock::now();
-        for (int iter = 0; iter < NUM_ITERATIONS; iter++) {
-            matrixMultiplyBruteForce(A, B, C1, n);
+        return;
+    }
+    if (r1 - r0 >= c1 - c0) {
+        const int rm = r0 + (r1 - r0) / 2;
+        transposeRecursive(src, r0, rm, c0, c1, store);
+        transposeRecursive(src, rm, r1, c0, c1, store);
+    } else {
+        const int cm = c0 + (c1 - c0) / 2;
+        transposeRecursive(src, r0, r1, c0, cm, store);
+        transposeRecursive(src, r0, r1, cm, c1, store);
+    }
+}
+
+/**
+ * Matrix Transpose
+ * Time Complexity: O(rows × cols / threads)
+ * Space Complexity: O(1) beyond the destination
+ * 
+ * Algorithm Steps:
+ * 1. Split the columns of src (rows of dst) between threads
+ * 2. Each thread transposes its column band with transposeRecursive
+ * 
+ * dst must be cols × rows and must not alias src.
+ */
+void transposeMatrix(long long** src, long long** dst, int rows, int cols, int numThreads = 0) {
+    parallelFor(0, cols, [&](int colBegin, int colEnd) {
+        auto store = [dst](int r, int c, long long value) { dst[r][c] = value; };
+        transposeRecursive(src, 0, rows, colBegin, colEnd, store);
+    }, numThreads);
+}
+
+/**
+ * Dense Matrix-Vector Multiplication (GEMV)
+ * Time Complexity: O(n² / threads)
+ * Space Complexity: O(1)
+ * 
+ * Algorithm Steps:
+ * 1. Split the rows of A between threads
+ * 2. For each row, compute the dot product with x using four independent
+ *    partial sums
+ * 3. Store alpha × sum + beta × y[i] in y[i]
+ * 
+ * Memory Optimization:
+ * - A is streamed once, row by row; x stays in cache
+ * - Independent partial sums break the add dependency chain so the loop
+ *   vectorizes and keeps several multiplies in flight
+ */
+void matrixVectorMultiply(long long** A, const long long* x, long long* y, int n, int numThreads = 0, long long alpha = 1, long long beta = 0) {
+    parallelFor(0, n, [&](int rowBegin, int rowEnd) {
+        for (int i = rowBegin; i < rowEnd; i++) {
+            const long long* row = A[i];
+            long long s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+            int k = 0;
+            for (; k + 4 <= n; k += 4) {
+                s0 += row[k] * x[k];
+                s1 += row[k + 1] * x[k + 1];
+                s2 += row[k + 2] * x[k + 2];
+                s3 += row[k + 3] * x[k + 3];
+            }
+            for (; k < n; k++) {
+                s0 += row[k] * x[k];
+            }
+            storeScaled(y[i], (s0 + s1) + (s2 + s3), alpha, beta);
         }
-        auto end = std::chrono::high_resolution_clock::now();
-        auto durationBF = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start);
-        double avgTimeBF = static_cast<double>(durationBF.count()) / NUM_ITERATIONS;
-        
-        // Measure divide and conquer
-        start = std::chrono::high_resolution_clock::now();
-        for (int iter = 0; iter < NUM_ITERATIONS; iter++) {
-            matrixMultiplyDivideConquer(A, B, C2, n);
+    }, numThreads);
+}
+
+/**
+ * Pack the n×k matrix B into one contiguous row-major buffer so the
+ * thin kernel reads it with unit stride regardless of how B was allocated.
+ */
+std::vector<long long> packThinMatrix(long long** B, int n, int k) {
+    std::vector<long long> packed(static_cast<size_t>(n) * k);
+    for (int r = 0; r < n; r++) {
+        std::memcpy(&packed[static_cast<size_t>(r) * k], B[r], static_cast<size_t>(k) * sizeof(long long));
+    }
+    return packed;
+}
+
+/**
+ * Thin kernel for one block of rows. With a compile-time width the k sums
+ * live in registers; Width = 0 handles any other k at run time.
+ */
+template <int Width>
+void thinRowsKernel(long long** A, const long long* packed, long long** C, int n, int k, int rowBegin, int rowEnd, long long alpha, long long beta) {
+    const int width = Width > 0 ? Width : k;
+    std::vector<long long> dynamicSums(Width > 0 ? 0 : k);
+    long long fixedSums[Width > 0 ? Width : 1];
+    long long* sums = Width > 0 ? fixedSums : dynamicSums.data();
+    for (int i = rowBegin; i < rowEnd; i++) {
+        for (int j = 0; j < width; j++) sums[j] = 0;
+        const long long* row = A[i];
+        for (int p = 0; p < n; p++) {
+            const long long a = row[p];
+            const long long* bRow = packed + static_cast<size_t>(p) * width;
+            for (int j = 0; j < width; j++) {
+                sums[j] += a * bRow[j];
+            }
         }
-        end = std::chrono::high_resolution_clock::now();
-        auto durationDC = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start);
-        double avgTimeDC = static_cast<double>(durationDC.count()) / NUM_ITERATIONS;
-        
-        // Verify results
-        bool resultsMatch = verifyMatrices(C1, C2, n);
-        
-        // Print results
-        std::cout << "Brute Force:" << std::endl;
-        std::cout << "Average Time: " << avgTimeBF << " nanoseconds" << std::endl;
-        
-        std::cout << std::endl;
+        for (int j = 0; j < width; j++) storeScaled(C[i][j], sums[j], alpha, beta);
+    }
+}
 
-        std::cout << "Divide & Conquer:" << std::endl;
-        std::cout << "Average Time: " << avgTimeDC << " nanoseconds" << std::endl;
+/**
+ * Matrix Times Thin Matrix (multiple right-hand sides)
+ * Time Complexity: O(n² × k / threads)
+ * Space Complexity: O(n × k) for the packed copy of B
+ * 
+ * Algorithm Steps:
+ * 1. k = 1 is a plain matrix-vector product
+ * 2. Pack the n×k matrix B contiguously
+ * 3. Split the rows of A between threads
+ * 4. For each row i, accumulate A[i][p] × B[p][0..k) into k sums and store
+ *    them in C[i]; k = 2, 4, 8 and 16 use register-resident sums
+ * 
+ * Memory Optimization:
+ * - A is read exactly once, unlike k separate matrix-vector products
+ * - The packed B (n × k) stays cache resident for small k
+ * - Accumulators stay local, so C is written once per row
+ */
+void matrixMultiplyThin(long long** A, long long** B, long long** C, int n, int k, int numThreads = 0, long long alpha = 1, long long beta = 0) {
+    if (k == 1) {
+        std::vector<long long> x(n), y(n);
+        for (int r = 0; r < n; r++) {
+            x[r] = B[r][0];
+            y[r] = beta == 0 ? 0 : C[r][0];
+        }
+        matrixVectorMultiply(A, x.data(), y.data(), n, numThreads, alpha, beta);
+        for (int r = 0; r < n; r++) C[r][0] = y[r];
+        return;
+    }
+    const std::vector<long long> packed = packThinMatrix(B, n, k);
+    parallelFor(0, n, [&](int rowBegin, int rowEnd) {
+        switch (k) {
+            case 2: thinRowsKernel<2>(A, packed.data(), C, n, k, rowBegin, rowEnd, alpha, beta); break;
+            case 4: thinRowsKernel<4>(A, packed.data(), C, n, k, rowBegin, rowEnd, alpha, beta); break;
+            case 8: thinRowsKernel<8>(A, packed.data(), C, n, k, rowBegin, rowEnd, alpha, beta); break;
+            case 16: thinRowsKernel<16>(A, packed.data(), C, n, k, rowBegin, rowEnd, alpha, beta); break;
+            default: thinRowsKernel<0>(A, packed.data(), C, n, k, rowBegin, rowEnd, alpha, beta); break;
+        }
+    }, numThreads);
+}
 
-        std::cout << std::endl;
+/**
+ * Bit-Packed Boolean Matrix
+ * Row-major, 64 entries per word; bit (j % 64) of word j / 64 in row i is
+ * entry (i, j). Padding bits past column n - 1 are always zero.
+ */
+struct BitMatrix {
+    int n = 0;
+    int words = 0;
+    std::vector<std::uint64_t> bits;
 
-        std::cout << "Results Match: " << (resultsMatch ? "Yes" : "No") << std::endl;
-        std::cout << "------------------------" << std::endl;
-        
-        // Clean up
+    std::uint64_t* row(int i) { return &bits[static_cast<size_t>(i) * words]; }
+    const std::uint64_t* row(int i) const { return &bits[static_cast<size_t>(i) * words]; }
+};
+
+/**
+ * Product over {0, 1}:
+ * - Or:  Boolean semiring (AND to multiply, OR to add), used for reachability
+ * - Xor: GF(2) (AND to multiply, XOR to add)
+ */
+enum class BooleanProduct { Or, Xor };
+
+BitMatrix createBitMatrix(int n) {
+    BitMatrix matrix;
+    matrix.n = n;
+    matrix.words = (n + 63) / 64;
+    matrix.bits.assign(static_cast<size_t>(n) * matrix.words, 0);
+    return matrix;
+}
+
+int popcount64(std::uint64_t x) {
+#if defined(__GNUC__)
+    return __builtin_popcountll(x);
+#else
+    int count = 0;
+    for (; x; x &= x - 1) count++;
+    return count;
+#endif
+}
+
+/**
+ * Pack a long long matrix into bits (nonzero → 1)
+ * Time Complexity: O(n²)
+ * Space Complexity: O(n² / 64)
+ */
+BitMatrix packBooleanMatrix(long long** matrix, int n) {
+    BitMatrix packed = createBitMatrix(n);
+    for (int i = 0; i < n; i++) {
+        std::uint64_t* row = packed.row(i);
         for (int j = 0; j < n; j++) {
-            delete[] A[j];
-            delete[] B[j];
-            delete[] C1[j];
-            delete[] C2[j];
+            if (matrix[i][j] != 0) row[j / 64] |= 1ULL << (j % 64);
+        }
+    }
+    return packed;
+}
+
+void unpackBooleanMatrix(const BitMatrix& packed, long long** matrix) {
+    for (int i = 0; i < packed.n; i++) {
+        const std::uint64_t* row = packed.row(i);
+        for (int j = 0; j < packed.n; j++) {
+            matrix[i][j] = static_cast<long long>((row[j / 64] >> (j % 64)) & 1);
         }
-        delete[] A;
-        delete[] B;
-        delete[] C1;
-        delete[] C2;
     }
+}
+
+BitMatrix transposeBitMatrix(const BitMatrix& matrix) {
+    BitMatrix transposed = createBitMatrix(matrix.n);
+    for (int i = 0; i < matrix.n; i++) {
+        const std::uint64_t* row = matrix.row(i);
+        for (int w = 0; w < matrix.words; w++) {
+            for (std::uint64_t word = row[w]; word; word &= word - 1) {
+                int j = w * 64 + popcount64((word & (~word + 1)) - 1);
+                transposed.row(j)[i / 64] |= 1ULL << (i % 64);
+            }
+        }
+    }
+    return transposed;
+}
+
+/**
+ * Boolean Multiplication with Popcount Dot Products
+ * Time Complexity: O(n³ / 64 / threads)
+ * Space Complexity: O(n² / 64) for the transpose of B
+ * 
+ * Algorithm Steps:
+ * 1. Transpose B so column j is a packed row
+ * 2. For each (i, j), AND row i of A with column j of B word by word
+ * 3. Or: entry is 1 if any word is nonzero (stops at the first one)
+ *    Xor: entry is the parity of the total popcount
+ * 
+ * Memory Optimization:
+ * - 64 products per AND instruction, 64× less memory than long long
+ * - Rows of A and columns of B are both read with unit stride
+ */
+BitMatrix booleanMultiplyPopcount(const BitMatrix& A, const BitMatrix& B, BooleanProduct product, int numThreads = 0) {
+    const int n = A.n;
+    BitMatrix C = createBitMatrix(n);
+    const BitMatrix BT = transposeBitMatrix(B);
+    parallelFor(0, n, [&](int rowBegin, int rowEnd) {
+        for (int i = rowBegin; i < rowEnd; i++) {
+            const std::uint64_t* a = A.row(i);
+            std::uint64_t* c = C.row(i);
+            for (int j = 0; j < n; j++) {
+                const std::uint64_t* b = BT.row(j);
+                std::uint64_t bit = 0;
+                if (product == BooleanProduct::Or) {
+                    for (int w = 0; w < A.words && !bit; w++) bit = (a[w] & b[w]) != 0;
+                } else {
+                    int count = 0;
+                    for (int w = 0; w < A.words; w++) count += popcount64(a[w] & b[w]);
+                    bit = static_cast<std::uint64_t>(count & 1);
+                }
+                c[j / 64] |= bit << (j % 64);
+            }
+        }
+    }, numThreads);
+    return C;
+}
+
+const int FOUR_RUSSIANS_BITS = 8;
+const int FOUR_RUSSIANS_TABLE = 1 << FOUR_RUSSIANS_BITS;
+
+/**
+ * Boolean Multiplication with the Method of Four Russians
+ * Time Complexity: O(n³ / (64 × 8) / threads)
+ * Space Complexity: O(groups × 256 × n / 64) for one batch of lookup tables
+ * 
+ * Algorithm Steps:
+ * 1. Split the rows of B into groups of 8
+ * 2. For each group, build a table of all 256 combinations of its rows:
+ *    table[m] = table[m without its lowest bit] (+) row of that bit,
+ *    which costs one row operation per entry
+ * 3. For each row i of A, read the 8 bits of A[i] covering the group and
+ *    combine the matching table entry into C[i] — one row operation
+ *    replaces up to eight
+ * 4. Tables for a batch of groups are built in parallel and sized to stay
+ *    in cache while every row applies them, then the next batch follows
+ * 
+ * Memory Optimization:
+ * - Only one batch of tables is alive at a time
+ * - Each table entry is a full packed row, combined word by word
+ */
+BitMatrix booleanMultiplyFourRussians(const BitMatrix& A, const BitMatrix& B, BooleanProduct product, int numThreads = 0) {
+    const int n = A.n;
+    const int words = A.words;
+    BitMatrix C = createBitMatrix(n);
+    const int groups = (n + FOUR_RUSSIANS_BITS - 1) / FOUR_RUSSIANS_BITS;
+    const size_t tableWords = static_cast<size_t>(FOUR_RUSSIANS_TABLE) * words;
+    // Keep one batch of tables within roughly 256 KB
+    const int batch = std::max(1, static_cast<int>((256 * 1024 / sizeof(std::uint64_t)) / tableWords));
+    std::vector<std::uint64_t> tables(tableWords * std::min(batch, groups));
+    const bool useXor = product == BooleanProduct::Xor;
+
+    for (int firstGroup = 0; firstGroup < groups; firstGroup += batch) {
+        const int batchGroups = std::min(batch, groups - firstGroup);
+
+        parallelFor(0, batchGroups, [&](int groupBegin, int groupEnd) {
+            for (int g = groupBegin; g < groupEnd; g++) {
+                std::uint64_t* table = &tables[static_cast<size_t>(g) * tableWords];
+                const int baseRow = (firstGroup + g) * FOUR_RUSSIANS_BITS;
+                std::fill(table, table + words, 0);
+                for (int m = 1; m < FOUR_RUSSIANS_TABLE; m++) {
+                    int low = popcount64(static_cast<std::uint64_t>((m & -m) - 1));
+                    std::uint64_t* entry = table + static_cast<size_t>(m) * words;
+                    const std::uint64_t* rest = table + static_cast<size_t>(m & (m - 1)) * words;
+                    if (baseRow + low >= n) {
+                        std::memcpy(entry, rest, words * sizeof(std::uint64_t));
+                        continue;
+                    }
+                    const std::uint64_t* bRow = B.row(baseRow + low);
+                    for (int w = 0; w < words; w++) {
+                        entry[w] = useXor ? (rest[w] ^ bRow[w]) : (rest[w] | bRow[w]);
+                    }
+                }
+            }
+        }, numThreads);
+
+        parallelFor(0, n, [&](int rowBegin, int rowEnd) {
+            for (int i = rowBegin; i < rowEnd; i++) {
+                const std::uint64_t* a = A.row(i);
+                std::uint64_t* c = C.row(i);
+                for (int g = 0; g < batchGroups; g++) {
+                    const int bit = (firstGroup + g) * FOUR_RUSSIANS_BITS;
+                    const int m = static_cast<int>((a[bit / 64] >> (bit % 64)) & (FOUR_RUSSIANS_TABLE - 1));
+                    if (m == 0) continue;
+                    const std::uint64_t* entry = &tables[static_cast<size_t>(g) * tableWords + static_cast<size_t>(m) * words];
+                    if (useXor) {
+                        for (int w = 0; w < words; w++) c[w] ^= entry[w];
+                    } else {
+                        for (int w = 0; w < words; w++) c[w] |= entry[w];
+                    }
+                }
+            }
+        }, numThreads);
+    }
+    return C;
+}
+
+/**
+ * Semirings for matrixMultiplySemiring
+ * 
+ * Each semiring supplies zero() (identity of add), add() and multiply().
+ * C[i][j] = add over k of multiply(A[i][k], B[k][j]), starting from zero().
+ * zeroAbsorbs declares that multiply(zero, x) == zero for every x.
+ * 
+ * - PlusTimesSemiring: ordinary product
+ * - MinPlusSemiring:   tropical product, shortest paths (SEMIRING_INFINITY = no edge)
+ * - MaxPlusSemiring:   longest paths / scheduling (-SEMIRING_INFINITY = no edge)
+ * - BooleanSemiring:   reachability over {0, 1}
+ * 
+ * In every semiring zero() absorbs under multiply: multiply(zero, x) is
+ * zero for any x. Min-plus and max-plus only get this by saturating, since
+ * INF + w is not INF once w is nonzero; "no path" entries would otherwise
+ * drift with every product, and tile skipping in matrixMultiplyBlockSparse
+ * relies on the zero absorbing. The check is a compare and a select, which
+ * still vectorizes. SEMIRING_INFINITY is small enough that adding two
+ * finite weights near it cannot overflow.
+ */
+const long long SEMIRING_INFINITY = LLONG_MAX / 4;
+
+struct PlusTimesSemiring {
+    static constexpr bool zeroAbsorbs = true;
+    static long long zero() { return 0; }
+    static long long add(long long a, long long b) { return a + b; }
+    static long long multiply(long long a, long long b) { return a * b; }
+};
+
+struct MinPlusSemiring {
+    static constexpr bool zeroAbsorbs = true;
+    static long long zero() { return SEMIRING_INFINITY; }
+    static long long add(long long a, long long b) { return a < b ? a : b; }
+    static long long multiply(long long a, long long b) {
+        return a >= SEMIRING_INFINITY || b >= SEMIRING_INFINITY ? SEMIRING_INFINITY : a + b;
+    }
+};
+
+struct MaxPlusSemiring {
+    static constexpr bool zeroAbsorbs = true;
+    static long long zero() { return -SEMIRING_INFINITY; }
+    static long long add(long long a, long long b) { return a > b ? a : b; }
+    static long long multiply(long long a, long long b) {
+        return a <= -SEMIRING_INFINITY || b <= -SEMIRING_INFINITY ? -SEMIRING_INFINITY : a + b;
+    }
+};
+
+struct BooleanSemiring {
+    static constexpr bool zeroAbsorbs = true;
+    static long long zero() { return 0; }
+    static long long add(long long a, long long b) { return a | b; }
+    static long long multiply(long long a, long long b) { return a & b; }
+};
+
+const int SEMIRING_BLOCK_ROWS = 32;
+const int SEMIRING_BLOCK_DEPTH = 128;
+const int SEMIRING_BLOCK_COLS = 256;
+
+const int SEMIRING_MICRO_ROWS = 4;
+const int SEMIRING_MICRO_COLS = 4;
+
+/**
+ * Semiring Tile Kernel
+ * C[i0..i1)[j0..j1) (+)= A[i0..i1)[k0..k1) (x) B[k0..k1)[j0..j1)
+ * 
+ * The tile is swept in 4×4 register blocks of C: each step over k loads
+ * four values of A and four of B and performs sixteen semiring updates,
+ * instead of two loads and a store per update. Leftover rows and columns
+ * use the same loop with narrower blocks.
+ */
+template <typename Semiring>
+void multiplyTileSemiring(long long** A, long long** B, long long** C, int i0, int i1, int k0, int k1, int j0, int j1) {
+    int i = i0;
+    for (; i + SEMIRING_MICRO_ROWS <= i1; i += SEMIRING_MICRO_ROWS) {
+        int j = j0;
+        for (; j + SEMIRING_MICRO_COLS <= j1; j += SEMIRING_MICRO_COLS) {
+            long long acc[SEMIRING_MICRO_ROWS][SEMIRING_MICRO_COLS];
+            for (int r = 0; r < SEMIRING_MICRO_ROWS; r++) {
+                for (int c = 0; c < SEMIRING_MICRO_COLS; c++) acc[r][c] = C[i + r][j + c];
+            }
+            for (int k = k0; k < k1; k++) {
+                const long long* bRow = B[k] + j;
+                for (int r = 0; r < SEMIRING_MICRO_ROWS; r++) {
+                    const long long a = A[i + r][k];
+                    for (int c = 0; c < SEMIRING_MICRO_COLS; c++) {
+                        acc[r][c] = Semiring::add(acc[r][c], Semiring::multiply(a, bRow[c]));
+                    }
+                }
+            }
+            for (int r = 0; r < SEMIRING_MICRO_ROWS; r++) {
+                for (int c = 0; c < SEMIRING_MICRO_COLS; c++) C[i + r][j + c] = acc[r][c];
+            }
+        }
+        for (; j < j1; j++) {
+            long long acc[SEMIRING_MICRO_ROWS];
+            for (int r = 0; r < SEMIRING_MICRO_ROWS; r++) acc[r] = C[i + r][j];
+            for (int k = k0; k < k1; k++) {
+                const long long b = B[k][j];
+                for (int r = 0; r < SEMIRING_MICRO_ROWS; r++) {
+                    acc[r] = Semiring::add(acc[r], Semiring::multiply(A[i + r][k], b));
+                }
+            }
+            for (int r = 0; r < SEMIRING_MICRO_ROWS; r++) C[i + r][j] = acc[r];
+        }
+    }
+    for (; i < i1; i++) {
+        long long* cRow = C[i];
+        for (int k = k0; k < k1; k++) {
+            const long long a = A[i][k];
+            const long long* bRow = B[k];
+            for (int j = j0; j < j1; j++) {
+                cRow[j] = Semiring::add(cRow[j], Semiring::multiply(a, bRow[j]));
+            }
+        }
+    }
+}
+
+/**
+ * Cache-Blocked Semiring Matrix Multiplication
+ * Time Complexity: O(n³ / threads)
+ * Space Complexity: O(1)
+ * 
+ * Algorithm Steps:
+ * 1. Fill C with the semiring zero
+ * 2. Split C into blocks of SEMIRING_BLOCK_ROWS rows, shared between threads
+ * 3. For each row block, walk k blocks and column blocks so one
+ *    SEMIRING_BLOCK_DEPTH × SEMIRING_BLOCK_COLS tile of B stays in cache
+ *    while every row of the block uses it
+ * 4. Combine each tile with multiplyTileSemiring
+ * 
+ * Memory Optimization:
+ * - Each thread owns whole rows of C, so no synchronization is needed
+ * - The semiring is a template parameter: add and multiply inline into
+ *   the inner loop and vectorize like a hand-written kernel
+ */
+template <typename Semiring>
+void matrixMultiplySemiring(long long** A, long long** B, long long** C, int n, int numThreads = 0) {
+    const int rowBlocks = (n + SEMIRING_BLOCK_ROWS - 1) / SEMIRING_BLOCK_ROWS;
+    parallelFor(0, rowBlocks, [&](int blockBegin, int blockEnd) {
+        for (int block = blockBegin; block < blockEnd; block++) {
+            const int i0 = block * SEMIRING_BLOCK_ROWS;
+            const int i1 = std::min(n, i0 + SEMIRING_BLOCK_ROWS);
+            for (int i = i0; i < i1; i++) {
+                std::fill(C[i], C[i] + n, Semiring::zero());
+            }
+            for (int k0 = 0; k0 < n; k0 += SEMIRING_BLOCK_DEPTH) {
+                const int k1 = std::min(n, k0 + SEMIRING_BLOCK_DEPTH);
+                for (int j0 = 0; j0 < n; j0 += SEMIRING_BLOCK_COLS) {
+                    const int j1 = std::min(n, j0 + SEMIRING_BLOCK_COLS);
+                    multiplyTileSemiring<Semiring>(A, B, C, i0, i1, k0, k1, j0, j1);
+                }
+            }
+        }
+    }, numThreads);
+}
+
+/**
+ * Rectangular Cache-Blocked Multiplication
+ * Time Complexity: O(m × k × n / threads)
+ * Space Complexity: O(1)
+ * 
+ * C (m × n) = alpha × A (m × k) × B (k × n) + beta × C, with the same
+ * row-block split and tile kernel as matrixMultiplySemiring. The tile
+ * kernel already takes independent row, depth and column ranges, so
+ * nothing in it assumes a square shape.
+ * 
+ * With alpha = 1 each row block of C is scaled by beta and the tile
+ * kernel adds the product straight into it. Otherwise the row block's
+ * product goes to a per-thread SEMIRING_BLOCK_ROWS × n scratch block,
+ * small enough to stay in cache, and is combined with C from there.
+ */
+void matrixMultiplyRectangular(long long** A, long long** B, long long** C, int m, int k, int n, int numThreads = 0,
+                               long long alpha = 1, long long beta = 0) {
+    const int rowBlocks = (m + SEMIRING_BLOCK_ROWS - 1) / SEMIRING_BLOCK_ROWS;
+    parallelFor(0, rowBlocks, [&](int blockBegin, int blockEnd) {
+        std::vector<long long> scratch(alpha == 1 ? 0 : static_cast<size_t>(SEMIRING_BLOCK_ROWS) * n);
+        std::vector<long long*> scratchRows(alpha == 1 ? 0 : m, nullptr);
+        for (int block = blockBegin; block < blockEnd; block++) {
+            const int i0 = block * SEMIRING_BLOCK_ROWS;
+            const int i1 = std::min(m, i0 + SEMIRING_BLOCK_ROWS);
+            long long** target = C;
+            if (alpha == 1) {
+                for (int i = i0; i < i1; i++) scaleRow(C[i], 0, n, beta);
+            } else {
+                for (int i = i0; i < i1; i++) {
+                    scratchRows[i] = scratch.data() + static_cast<size_t>(i - i0) * n;
+                    std::fill(scratchRows[i], scratchRows[i] + n, 0LL);
+                }
+                target = scratchRows.data();
+            }
+            for (int k0 = 0; k0 < k; k0 += SEMIRING_BLOCK_DEPTH) {
+                const int k1 = std::min(k, k0 + SEMIRING_BLOCK_DEPTH);
+                for (int j0 = 0; j0 < n; j0 += SEMIRING_BLOCK_COLS) {
+                    const int j1 = std::min(n, j0 + SEMIRING_BLOCK_COLS);
+                    multiplyTileSemiring<PlusTimesSemiring>(A, B, target, i0, i1, k0, k1, j0, j1);
+                }
+            }
+            if (alpha != 1) {
+                for (int i = i0; i < i1; i++) {
+                    for (int j = 0; j < n; j++) storeScaled(C[i][j], scratchRows[i][j], alpha, beta);
+                }
+            }
+        }
+    }, numThreads);
+}
+
+/**
+ * Cache-Blocked Matrix Multiplication
+ * The (+, ×) instance of matrixMultiplySemiring, extended to
+ * C = alpha × A × B + beta × C.
+ */
+void matrixMultiplyBlocked(long long** A, long long** B, long long** C, int n, int numThreads = 0, long long alpha = 1, long long beta = 0) {
+    if (alpha == 1 && beta == 0) {
+        matrixMultiplySemiring<PlusTimesSemiring>(A, B, C, n, numThreads);
+        return;
+    }
+    matrixMultiplyRectangular(A, B, C, n, n, n, numThreads, alpha, beta);
+}
+
+/**
+ * Tile Occupancy Bitmap
+ * One bit per tileHeight × tileWidth tile; a clear bit means every element
+ * of the tile equals the semiring zero.
+ */
+struct TileOccupancy {
+    int tileRows = 0;
+    int tileCols = 0;
+    std::vector<std::uint64_t> bits;
+
+    bool occupied(int r, int c) const {
+        size_t index = static_cast<size_t>(r) * tileCols + c;
+        return (bits[index / 64] >> (index % 64)) & 1;
+    }
+};
+
+/**
+ * Build the occupancy bitmap of a matrix
+ * Time Complexity: O(n² / threads)
+ * Space Complexity: O(n² / (tileHeight × tileWidth) / 64)
+ * 
+ * Threads own whole tile rows, but neighbouring tile rows can share a
+ * bitmap word, so each thread collects its bits locally and merges them
+ * under a lock.
+ */
+template <typename Semiring>
+TileOccupancy computeTileOccupancy(long long** M, int n, int tileHeight, int tileWidth, int numThreads = 0) {
+    TileOccupancy occupancy;
+    occupancy.tileRows = (n + tileHeight - 1) / tileHeight;
+    occupancy.tileCols = (n + tileWidth - 1) / tileWidth;
+    occupancy.bits.assign((static_cast<size_t>(occupancy.tileRows) * occupancy.tileCols + 63) / 64, 0);
+    std::mutex mutex;
+    parallelFor(0, occupancy.tileRows, [&](int tileBegin, int tileEnd) {
+        std::vector<size_t> set;
+        for (int tr = tileBegin; tr < tileEnd; tr++) {
+            for (int tc = 0; tc < occupancy.tileCols; tc++) {
+                bool nonZero = false;
+                for (int i = tr * tileHeight; i < std::min(n, (tr + 1) * tileHeight) && !nonZero; i++) {
+                    for (int j = tc * tileWidth; j < std::min(n, (tc + 1) * tileWidth); j++) {
+                        if (M[i][j] != Semiring::zero()) {
+                            nonZero = true;
+                            break;
+                        }
+                    }
+                }
+                if (nonZero) set.push_back(static_cast<size_t>(tr) * occupancy.tileCols + tc);
+            }
+        }
+        std::lock_guard<std::mutex> lock(mutex);
+        for (size_t index : set) occupancy.bits[index / 64] |= 1ULL << (index % 64);
+    }, numThreads);
+    return occupancy;
+}
+
+/**
+ * Block-Sparse Semiring Matrix Multiplication
+ * Time Complexity: O(n² + occupied tile products × tile volume / threads)
+ * Space Complexity: O(n² / tile area) for the two bitmaps
+ * 
+ * Algorithm Steps:
+ * 1. Build occupancy bitmaps of A (row × depth tiles) and B (depth ×
+ *    column tiles) with the same tile sizes as matrixMultiplySemiring
+ * 2. Run the blocked loop, skipping every tile product whose A tile or
+ *    B tile is entirely the semiring zero — such a product contributes
+ *    nothing, provided the zero absorbs under multiply
+ * 3. A whole k step is skipped when its A tile is empty
+ * 
+ * A semiring whose zeroAbsorbs is false goes to matrixMultiplySemiring,
+ * since a skipped tile product would no longer be a no-op.
+ * 
+ * This is the tile-level version of skipping zero elements: one bit test
+ * decides thousands of multiplications, so the check pays for itself on
+ * banded and block-structured inputs and costs almost nothing on dense ones.
+ * For min-plus the "zero" is SEMIRING_INFINITY, so missing-edge blocks of
+ * a graph are skipped the same way.
+ */
+template <typename Semiring>
+void matrixMultiplyBlockSparse(long long** A, long long** B, long long** C, int n, int numThreads = 0) {
+    if constexpr (!Semiring::zeroAbsorbs) {
+        matrixMultiplySemiring<Semiring>(A, B, C, n, numThreads);
+        return;
+    }
+    const TileOccupancy occupancyA = computeTileOccupancy<Semiring>(A, n, SEMIRING_BLOCK_ROWS, SEMIRING_BLOCK_DEPTH, numThreads);
+    const TileOccupancy occupancyB = computeTileOccupancy<Semiring>(B, n, SEMIRING_BLOCK_DEPTH, SEMIRING_BLOCK_COLS, numThreads);
+    const int rowBlocks = occupancyA.tileRows;
+    parallelFor(0, rowBlocks, [&](int blockBegin, int blockEnd) {
+        for (int block = blockBegin; block < blockEnd; block++) {
+            const int i0 = block * SEMIRING_BLOCK_ROWS;
+            const int i1 = std::min(n, i0 + SEMIRING_BLOCK_ROWS);
+            for (int i = i0; i < i1; i++) {
+                std::fill(C[i], C[i] + n, Semiring::zero());
+            }
+            for (int kb = 0; kb < occupancyA.tileCols; kb++) {
+                if (!occupancyA.occupied(block, kb)) continue;
+                const int k0 = kb * SEMIRING_BLOCK_DEPTH;
+                const int k1 = std::min(n, k0 + SEMIRING_BLOCK_DEPTH);
+                for (int jb = 0; jb < occupancyB.tileCols; jb++) {
+                    if (!occupancyB.occupied(kb, jb)) continue;
+                    const int j0 = jb * SEMIRING_BLOCK_COLS;
+                    const int j1 = std::min(n, j0 + SEMIRING_BLOCK_COLS);
+                    multiplyTileSemiring<Semiring>(A, B, C, i0, i1, k0, k1, j0, j1);
+                }
+            }
+        }
+    }, numThreads);
+}
+
+/**
+ * Reference Semiring Multiplication
+ * Time Complexity: O(n³)
+ * Space Complexity: O(1)
+ * 
+ * Plain i-j-k triple loop over any semiring, kept as the correctness
+ * baseline for the blocked engine.
+ */
+template <typename Semiring>
+void matrixMultiplySemiringNaive(long long** A, long long** B, long long** C, int n) {
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            long long sum = Semiring::zero();
+            for (int k = 0; k < n; k++) {
+                sum = Semiring::add(sum, Semiring::multiply(A[i][k], B[k][j]));
+            }
+            C[i][j] = sum;
+        }
+    }
+}
+
+/**
+ * Smallest and largest element of a matrix (row-parallel reduction).
+ */
+struct ValueRange {
+    long long minValue;
+    long long maxValue;
+};
+
+ValueRange matrixValueRange(long long** matrix, int rows, int cols, int numThreads = 0) {
+    std::mutex mutex;
+    ValueRange range = {LLONG_MAX, LLONG_MIN};
+    parallelFor(0, rows, [&](int rowBegin, int rowEnd) {
+        ValueRange local = {LLONG_MAX, LLONG_MIN};
+        for (int i = rowBegin; i < rowEnd; i++) {
+            for (int j = 0; j < cols; j++) {
+                local.minValue = std::min(local.minValue, matrix[i][j]);
+                local.maxValue = std::max(local.maxValue, matrix[i][j]);
+            }
+        }
+        std::lock_guard<std::mutex> lock(mutex);
+        range.minValue = std::min(range.minValue, local.minValue);
+        range.maxValue = std::max(range.maxValue, local.maxValue);
+    }, numThreads);
+    return range;
+}
+
+/**
+ * Storage type chosen by the narrow engine. Int16 excludes -32768 so one
+ * pmaddwd pair sum (2 × 32767²) always fits in an int32 lane.
+ */
+enum class NarrowElement { None, Int8, Int16 };
+
+NarrowElement narrowElementFor(ValueRange a, ValueRange b) {
+    long long low = std::min(a.minValue, b.minValue);
+    long long high = std::max(a.maxValue, b.maxValue);
+    if (low >= INT8_MIN && high <= INT8_MAX) return NarrowElement::Int8;
+    if (low >= -INT16_MAX && high <= INT16_MAX) return NarrowElement::Int16;
+    return NarrowElement::None;
+}
+
+const int NARROW_VECTOR = 8;   // int16 lanes per 128-bit pmaddwd
+const int NARROW_COLUMNS = 4;  // columns of B per register block
+
+#if defined(__SSE2__)
+// Load eight narrow elements widened to eight int16 lanes
+inline __m128i loadInt16x8(const std::int16_t* p) {
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+}
+
+inline __m128i loadInt16x8(const std::int8_t* p) {
+    __m128i bytes = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(p));
+    return _mm_srai_epi16(_mm_unpacklo_epi8(bytes, bytes), 8);
+}
+
+inline long long sumInt32x4(__m128i v) {
+    alignas(16) std::int32_t lanes[4];
+    _mm_store_si128(reinterpret_cast<__m128i*>(lanes), v);
+    return static_cast<long long>(lanes[0]) + lanes[1] + lanes[2] + lanes[3];
+}
+#endif
+
+/**
+ * Narrow Dot-Product Kernel
+ * out[c] = Σ_k a[k] × b_c[k] for NARROW_COLUMNS packed columns of B.
+ * 
+ * Each pmaddwd multiplies eight int16 pairs and adds adjacent products
+ * into four int32 lanes. Lanes are widened into 64-bit totals every
+ * blockSteps vectors, which bounds the int32 sum below 2^31.
+ */
+template <typename Narrow>
+void narrowDotProducts(const Narrow* a, const Narrow* const* b, int paddedDepth, int blockSteps, long long* out) {
+    for (int c = 0; c < NARROW_COLUMNS; c++) out[c] = 0;
+    const int blockDepth = blockSteps * NARROW_VECTOR;
+    for (int k0 = 0; k0 < paddedDepth; k0 += blockDepth) {
+        const int k1 = std::min(paddedDepth, k0 + blockDepth);
+#if defined(__SSE2__)
+        __m128i acc[NARROW_COLUMNS];
+        for (int c = 0; c < NARROW_COLUMNS; c++) acc[c] = _mm_setzero_si128();
+        for (int k = k0; k < k1; k += NARROW_VECTOR) {
+            const __m128i va = loadInt16x8(a + k);
+            for (int c = 0; c < NARROW_COLUMNS; c++) {
+                acc[c] = _mm_add_epi32(acc[c], _mm_madd_epi16(va, loadInt16x8(b[c] + k)));
+            }
+        }
+        for (int c = 0; c < NARROW_COLUMNS; c++) out[c] += sumInt32x4(acc[c]);
+#else
+        // blockSteps bounds one pmaddwd lane, which sees a quarter of the
+        // block; a single scalar sum of the whole block needs 64 bits
+        for (int c = 0; c < NARROW_COLUMNS; c++) {
+            std::int64_t acc = 0;
+            for (int k = k0; k < k1; k++) acc += static_cast<std::int32_t>(a[k]) * b[c][k];
+            out[c] += acc;
+        }
+#endif
+    }
+}
+
+/**
+ * Narrow-Element Matrix Multiplication for one storage type
+ * Time Complexity: O(n³ / threads)
+ * Space Complexity: O(n² × sizeof(Narrow))
+ * 
+ * Algorithm Steps:
+ * 1. Pack A row by row and B column by column (transposed) into Narrow,
+ *    zero-padding the depth to a multiple of eight
+ * 2. Derive the overflow-safe block length from the operand magnitudes
+ * 3. Split rows of C between threads; compute four columns at a time with
+ *    narrowDotProducts, leftover columns against a zero column
+ * 
+ * Memory Optimization:
+ * - int8 operands are 8× smaller than long long, int16 ones 4×, so the
+ *   kernel streams a fraction of the bytes
+ * - Transposed B makes every dot product two unit-stride streams
+ */
+template <typename Narrow>
+void matrixMultiplyNarrowTyped(long long** A, long long** B, long long** C, int n, long long maxMagnitude, int numThreads, long long alpha, long long beta) {
+    const int paddedDepth = (n + NARROW_VECTOR - 1) / NARROW_VECTOR * NARROW_VECTOR;
+    std::vector<Narrow> packedA(static_cast<size_t>(n) * paddedDepth, 0);
+    std::vector<Narrow> packedB(static_cast<size_t>(n + 1) * paddedDepth, 0);  // Last column stays zero
+    for (int i = 0; i < n; i++) {
+        for (int k = 0; k < n; k++) {
+            packedA[static_cast<size_t>(i) * paddedDepth + k] = static_cast<Narrow>(A[i][k]);
+            packedB[static_cast<size_t>(i) * paddedDepth + k] = static_cast<Narrow>(B[k][i]);
+        }
+    }
+    const long long pairBound = std::max(1LL, 2 * maxMagnitude * maxMagnitude);
+    const int blockSteps = static_cast<int>(std::max(1LL, std::min<long long>(INT32_MAX / pairBound, n)));
+    const Narrow* zeroColumn = &packedB[static_cast<size_t>(n) * paddedDepth];
+
+    parallelFor(0, n, [&](int rowBegin, int rowEnd) {
+        long long out[NARROW_COLUMNS];
+        const Narrow* columns[NARROW_COLUMNS];
+        for (int i = rowBegin; i < rowEnd; i++) {
+            const Narrow* a = &packedA[static_cast<size_t>(i) * paddedDepth];
+            for (int j = 0; j < n; j += NARROW_COLUMNS) {
+                for (int c = 0; c < NARROW_COLUMNS; c++) {
+                    columns[c] = j + c < n ? &packedB[static_cast<size_t>(j + c) * paddedDepth] : zeroColumn;
+                }
+                narrowDotProducts(a, columns, paddedDepth, blockSteps, out);
+                for (int c = 0; c < NARROW_COLUMNS && j + c < n; c++) storeScaled(C[i][j + c], out[c], alpha, beta);
+            }
+        }
+    }, numThreads);
+}
+
+/**
+ * Narrow-Element Matrix Multiplication
+ * Time Complexity: O(n³ / threads)
+ * Space Complexity: O(n²) narrow copies of A and B
+ * 
+ * Algorithm Steps:
+ * 1. Pick int8 or int16 storage from the operand value ranges
+ * 2. Multiply through pmaddwd with int32 lanes widened to 64 bits often
+ *    enough to never overflow
+ * 3. Operands that fit neither fall back to matrixMultiplyBlocked
+ * 
+ * Returns the storage type used (None for the fallback).
+ */
+NarrowElement matrixMultiplyNarrow(long long** A, long long** B, long long** C, int n,
+                                   ValueRange rangeA, ValueRange rangeB, int numThreads = 0,
+                                   long long alpha = 1, long long beta = 0) {
+    const NarrowElement element = narrowElementFor(rangeA, rangeB);
+    // Magnitudes on the unsigned type: |LLONG_MIN| does not fit in long long
+    auto magnitude = [](long long value) {
+        return value < 0 ? 0ULL - static_cast<unsigned long long>(value) : static_cast<unsigned long long>(value);
+    };
+    const long long maxMagnitude = static_cast<long long>(std::min<unsigned long long>(
+        LLONG_MAX, std::max({magnitude(rangeA.minValue), magnitude(rangeA.maxValue), magnitude(rangeB.minValue),
+                             magnitude(rangeB.maxValue)})));
+    switch (element) {
+        case NarrowElement::Int8:
+            matrixMultiplyNarrowTyped<std::int8_t>(A, B, C, n, maxMagnitude, numThreads, alpha, beta);
+            break;
+        case NarrowElement::Int16:
+            matrixMultiplyNarrowTyped<std::int16_t>(A, B, C, n, maxMagnitude, numThreads, alpha, beta);
+            break;
+        case NarrowElement::None:
+            matrixMultiplyBlocked(A, B, C, n, numThreads, alpha, beta);
+            break;
+    }
+    return element;
+}
+
+NarrowElement matrixMultiplyNarrow(long long** A, long long** B, long long** C, int n, int numThreads = 0,
+                                   long long alpha = 1, long long beta = 0) {
+    return matrixMultiplyNarrow(A, B, C, n, matrixValueRange(A, n, n, numThreads), matrixValueRange(B, n, n, numThreads),
+                                numThreads, alpha, beta);
+}
+
+/**
+ * Operand transposition for the packing engines: op(M) is M or M^T.
+ */
+enum class Transpose { None, Transposed };
+
+/**
+ * Exact-in-Double Bound
+ * Time Complexity: O(n²)
+ * Space Complexity: O(1)
+ * 
+ * |C[i][j]| and every partial sum on the way are at most
+ * (max_i Σ_k |op(A)[i][k]|) × max |B|. When that is below 2^53 every product
+ * and every partial sum is an integer a double represents exactly, so a
+ * double (or FMA) product rounds nowhere and converts back without loss.
+ * The rows of A^T are the columns of A; transposing B does not change max |B|.
+ */
+bool productExactInDouble(long long** A, long long** B, int n, Transpose opA = Transpose::None) {
+    const double EXACT_LIMIT = 9007199254740992.0;  // 2^53
+    double maxRowSum = 0.0;
+    double maxB = 0.0;
+    std::vector<double> columnSums(opA == Transpose::Transposed ? n : 0, 0.0);
+    for (int i = 0; i < n; i++) {
+        double rowSum = 0.0;
+        for (int k = 0; k < n; k++) {
+            const double a = std::fabs(static_cast<double>(A[i][k]));
+            if (opA == Transpose::Transposed) {
+                columnSums[k] += a;
+            } else {
+                rowSum += a;
+            }
+            maxB = std::max(maxB, std::fabs(static_cast<double>(B[i][k])));
+        }
+        maxRowSum = std::max(maxRowSum, rowSum);
+    }
+    for (double columnSum : columnSums) maxRowSum = std::max(maxRowSum, columnSum);
+    // Keep a margin for the rounding of the bound computation itself
+    return maxRowSum * maxB < EXACT_LIMIT * (1.0 - 1e-9);
+}
+
+const int EXACT_MICRO_ROWS = 4;
+const int EXACT_MICRO_COLS = 8;
+const int EXACT_BLOCK_DEPTH = 256;
+
+/**
+ * Double Micro-Kernels
+ * C[i..i+4)[j..j+8) += A[i..i+4)[k0..k1) × B[k0..k1)[j..j+8) on padded,
+ * row-major double buffers with leading dimension ld.
+ * 
+ * The FMA version keeps the 4×8 block in eight 256-bit registers and
+ * issues one vfmadd231pd per register per k; it is compiled for AVX2/FMA
+ * and only called when the CPU reports FMA. The SSE2 version is the
+ * portable baseline.
+ */
+#if defined(__GNUC__) && defined(__x86_64__)
+__attribute__((target("avx2,fma")))
+void exactMicroKernelFma(const double* A, const double* B, double* C, int ld, int i, int j, int k0, int k1) {
+    __m256d acc[EXACT_MICRO_ROWS][2];
+    for (int r = 0; r < EXACT_MICRO_ROWS; r++) {
+        acc[r][0] = _mm256_loadu_pd(C + static_cast<size_t>(i + r) * ld + j);
+        acc[r][1] = _mm256_loadu_pd(C + static_cast<size_t>(i + r) * ld + j + 4);
+    }
+    for (int k = k0; k < k1; k++) {
+        const __m256d b0 = _mm256_loadu_pd(B + static_cast<size_t>(k) * ld + j);
+        const __m256d b1 = _mm256_loadu_pd(B + static_cast<size_t>(k) * ld + j + 4);
+        for (int r = 0; r < EXACT_MICRO_ROWS; r++) {
+            const __m256d a = _mm256_broadcast_sd(A + static_cast<size_t>(i + r) * ld + k);
+            acc[r][0] = _mm256_fmadd_pd(a, b0, acc[r][0]);
+            acc[r][1] = _mm256_fmadd_pd(a, b1, acc[r][1]);
+        }
+    }
+    for (int r = 0; r < EXACT_MICRO_ROWS; r++) {
+        _mm256_storeu_pd(C + static_cast<size_t>(i + r) * ld + j, acc[r][0]);
+        _mm256_storeu_pd(C + static_cast<size_t>(i + r) * ld + j + 4, acc[r][1]);
+    }
+}
+
+bool cpuSupportsFma() {
+    static const bool supported = __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+    return supported;
+}
+#else
+bool cpuSupportsFma() {
+    return false;
+}
+#endif
+
+void exactMicroKernel(const double* A, const double* B, double* C, int ld, int i, int j, int k0, int k1) {
+#if defined(__SSE2__)
+    __m128d acc[EXACT_MICRO_ROWS][EXACT_MICRO_COLS / 2];
+    for (int r = 0; r < EXACT_MICRO_ROWS; r++) {
+        for (int c = 0; c < EXACT_MICRO_COLS / 2; c++) {
+            acc[r][c] = _mm_loadu_pd(C + static_cast<size_t>(i + r) * ld + j + 2 * c);
+        }
+    }
+    for (int k = k0; k < k1; k++) {
+        const double* bRow = B + static_cast<size_t>(k) * ld + j;
+        for (int r = 0; r < EXACT_MICRO_ROWS; r++) {
+            const __m128d a = _mm_set1_pd(A[static_cast<size_t>(i + r) * ld + k]);
+            for (int c = 0; c < EXACT_MICRO_COLS / 2; c++) {
+                acc[r][c] = _mm_add_pd(acc[r][c], _mm_mul_pd(a, _mm_loadu_pd(bRow + 2 * c)));
+            }
+        }
+    }
+    for (int r = 0; r < EXACT_MICRO_ROWS; r++) {
+        for (int c = 0; c < EXACT_MICRO_COLS / 2; c++) {
+            _mm_storeu_pd(C + static_cast<size_t>(i + r) * ld + j + 2 * c, acc[r][c]);
+        }
+    }
+#else
+    for (int r = 0; r < EXACT_MICRO_ROWS; r++) {
+        double* cRow = C + static_cast<size_t>(i + r) * ld + j;
+        for (int k = k0; k < k1; k++) {
+            const double a = A[static_cast<size_t>(i + r) * ld + k];
+            const double* bRow = B + static_cast<size_t>(k) * ld + j;
+            for (int c = 0; c < EXACT_MICRO_COLS; c++) cRow[c] += a * bRow[c];
+        }
+    }
+#endif
+}
+
+/**
+ * C += A × B over padded double buffers with leading dimension ld: A is
+ * paddedRows × depth, B is depth × paddedCols. Row blocks are split
+ * between threads; for each depth block of blockDepth, the FMA (or SSE2)
+ * micro-kernel runs over a thread's rows, so that block of B stays cache
+ * resident.
+ */
+void exactMicroKernelSweep(const double* a, const double* b, double* c, int ld, int paddedRows, int paddedCols, int depth,
+                           int blockDepth, int numThreads) {
+#if defined(__GNUC__) && defined(__x86_64__)
+    const bool useFma = cpuSupportsFma();
+#endif
+    parallelFor(0, paddedRows / EXACT_MICRO_ROWS, [&](int blockBegin, int blockEnd) {
+        for (int k0 = 0; k0 < depth; k0 += blockDepth) {
+            const int k1 = std::min(depth, k0 + blockDepth);
+            for (int block = blockBegin; block < blockEnd; block++) {
+                const int i = block * EXACT_MICRO_ROWS;
+                for (int j = 0; j < paddedCols; j += EXACT_MICRO_COLS) {
+#if defined(__GNUC__) && defined(__x86_64__)
+                    if (useFma) {
+                        exactMicroKernelFma(a, b, c, ld, i, j, k0, k1);
+                        continue;
+                    }
+#endif
+                    exactMicroKernel(a, b, c, ld, i, j, k0, k1);
+                }
+            }
+        }
+    }, numThreads);
+}
+
+/**
+ * Pack op(M) into a row-major double buffer with leading dimension ld.
+ * Transposed operands are read through transposeRecursive, so the strided
+ * side of the copy stays cache friendly; either way the kernel sees a
+ * plain row-major operand and never knows a transpose was asked for.
+ */
+void packExactOperand(long long** M, int n, Transpose op, double* packed, int ld) {
+    if (op == Transpose::Transposed) {
+        auto store = [packed, ld](int r, int c, long long value) {
+            packed[static_cast<size_t>(r) * ld + c] = static_cast<double>(value);
+        };
+        transposeRecursive(M, 0, n, 0, n, store);
+        return;
+    }
+    for (int i = 0; i < n; i++) {
+        for (int k = 0; k < n; k++) {
+            packed[static_cast<size_t>(i) * ld + k] = static_cast<double>(M[i][k]);
+        }
+    }
+}
+
+/**
+ * Exact Integer Multiplication through Double Precision
+ * Time Complexity: O(n³ / threads)
+ * Space Complexity: O(n²) for three padded double buffers
+ * 
+ * Computes C = op(A) × op(B), where op is selected per operand.
+ * 
+ * Algorithm Steps:
+ * 1. Prove the product exact in double with productExactInDouble;
+ *    otherwise fall back to matrixMultiplyBlocked (on explicitly
+ *    transposed copies if a transpose was requested) and return false
+ * 2. Pack op(A) and op(B) to doubles, padding to multiples of the 4×8
+ *    block; transposes are absorbed here
+ * 3. Split row blocks between threads; for each depth block of
+ *    blockDepth (EXACT_BLOCK_DEPTH unless a plan picks one), run the FMA
+ *    (or SSE2) micro-kernel over the row block
+ * 4. Convert C back to long long — exact, since every value is an integer
+ *    below 2^53 — and apply alpha and beta in integer arithmetic
+ * 
+ * Memory Optimization:
+ * - A depth block of B (blockDepth rows) stays cache resident
+ *   while a thread sweeps its rows over it
+ * - x86 has no 64-bit integer vector multiply before AVX-512, while double
+ *   FMA handles four products per instruction
+ * - A^T × B and A × B^T cost no extra pass or n×n allocation: packing
+ *   already copies every element once
+ */
+bool matrixMultiplyExactDouble(long long** A, long long** B, long long** C, int n, Transpose opA, Transpose opB,
+                               int numThreads = 0, long long alpha = 1, long long beta = 0,
+                               int blockDepth = EXACT_BLOCK_DEPTH) {
+    if (!productExactInDouble(A, B, n, opA)) {
+        long long** At = opA == Transpose::Transposed ? allocateMatrix(n) : nullptr;
+        long long** Bt = opB == Transpose::Transposed ? allocateMatrix(n) : nullptr;
+        if (At) transposeMatrix(A, At, n, n, numThreads);
+        if (Bt) transposeMatrix(B, Bt, n, n, numThreads);
+        matrixMultiplyBlocked(At ? At : A, Bt ? Bt : B, C, n, numThreads, alpha, beta);
+        if (At) freeMatrix(At);
+        if (Bt) freeMatrix(Bt);
+        return false;
+    }
+    const int ld = (n + EXACT_MICRO_COLS - 1) / EXACT_MICRO_COLS * EXACT_MICRO_COLS;
+    const int paddedRows = (n + EXACT_MICRO_ROWS - 1) / EXACT_MICRO_ROWS * EXACT_MICRO_ROWS;
+    std::vector<double> a(static_cast<size_t>(paddedRows) * ld, 0.0);
+    std::vector<double> b(static_cast<size_t>(ld) * ld, 0.0);
+    std::vector<double> c(static_cast<size_t>(paddedRows) * ld, 0.0);
+    packExactOperand(A, n, opA, a.data(), ld);
+    packExactOperand(B, n, opB, b.data(), ld);
+    exactMicroKernelSweep(a.data(), b.data(), c.data(), ld, paddedRows, ld, n, blockDepth, numThreads);
+
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            storeScaled(C[i][j], static_cast<long long>(c[static_cast<size_t>(i) * ld + j]), alpha, beta);
+        }
+    }
+    return true;
+}
+
+bool matrixMultiplyExactDouble(long long** A, long long** B, long long** C, int n, int numThreads = 0,
+                               long long alpha = 1, long long beta = 0) {
+    return matrixMultiplyExactDouble(A, B, C, n, Transpose::None, Transpose::None, numThreads, alpha, beta);
+}
+
+/**
+ * Compressed Sparse Row Matrix
+ * Row i holds the nonzeros colIdx[rowPtr[i] .. rowPtr[i+1]) with the
+ * matching values; column indices are increasing within a row.
+ */
+struct CsrMatrix {
+    int rows = 0;
+    int cols = 0;
+    std::vector<int> rowPtr;
+    std::vector<int> colIdx;
+    std::vector<long long> values;
+
+    long long nonZeros() const { return static_cast<long long>(values.size()); }
+};
+
+/**
+ * Dense to CSR Conversion
+ * Time Complexity: O(rows × cols)
+ * Space Complexity: O(rows + nonzeros)
+ * 
+ * Algorithm Steps:
+ * 1. Count the nonzeros of every row (in parallel) and prefix-sum them
+ *    into rowPtr
+ * 2. Fill each row's column indices and values (in parallel)
+ */
+CsrMatrix denseToCsr(long long** matrix, int rows, int cols, int numThreads = 0) {
+    CsrMatrix csr;
+    csr.rows = rows;
+    csr.cols = cols;
+    csr.rowPtr.assign(rows + 1, 0);
+    parallelFor(0, rows, [&](int rowBegin, int rowEnd) {
+        for (int i = rowBegin; i < rowEnd; i++) {
+            int count = 0;
+            for (int j = 0; j < cols; j++) count += matrix[i][j] != 0;
+            csr.rowPtr[i + 1] = count;
+        }
+    }, numThreads);
+    for (int i = 0; i < rows; i++) csr.rowPtr[i + 1] += csr.rowPtr[i];
+    csr.colIdx.resize(csr.rowPtr[rows]);
+    csr.values.resize(csr.rowPtr[rows]);
+    parallelFor(0, rows, [&](int rowBegin, int rowEnd) {
+        for (int i = rowBegin; i < rowEnd; i++) {
+            int out = csr.rowPtr[i];
+            for (int j = 0; j < cols; j++) {
+                if (matrix[i][j] != 0) {
+                    csr.colIdx[out] = j;
+                    csr.values[out] = matrix[i][j];
+                    out++;
+                }
+            }
+        }
+    }, numThreads);
+    return csr;
+}
+
+void csrToDense(const CsrMatrix& csr, long long** matrix) {
+    for (int i = 0; i < csr.rows; i++) {
+        std::fill(matrix[i], matrix[i] + csr.cols, 0);
+        for (int p = csr.rowPtr[i]; p < csr.rowPtr[i + 1]; p++) {
+            matrix[i][csr.colIdx[p]] = csr.values[p];
+        }
+    }
+}
+
+/**
+ * Fraction of nonzero elements.
+ */
+double matrixDensity(long long** matrix, int rows, int cols) {
+    long long nonZeros = 0;
+    for (int i = 0; i < rows; i++) {
+        for (int j = 0; j < cols; j++) nonZeros += matrix[i][j] != 0;
+    }
+    return rows > 0 && cols > 0 ? static_cast<double>(nonZeros) / (static_cast<double>(rows) * cols) : 0.0;
+}
+
+/**
+ * Row boundaries that give every part about the same amount of work.
+ * prefixWork[i] is the work of rows [0, i), so rows of very different
+ * cost still balance across threads.
+ */
+template <typename Work>
+std::vector<int> balancedRowSplit(const std::vector<Work>& prefixWork, int rows, int parts) {
+    std::vector<int> bounds(parts + 1, rows);
+    bounds[0] = 0;
+    for (int t = 1; t < parts; t++) {
+        Work target = static_cast<Work>(static_cast<long long>(prefixWork[rows]) * t / parts);
+        bounds[t] = static_cast<int>(std::lower_bound(prefixWork.begin(), prefixWork.begin() + rows + 1, target) - prefixWork.begin());
+        bounds[t] = std::max(bounds[t - 1], std::min(bounds[t], rows));
+    }
+    return bounds;
+}
+
+std::vector<int> balancedCsrRowSplit(const CsrMatrix& csr, int parts) {
+    return balancedRowSplit(csr.rowPtr, csr.rows, parts);
+}
+
+/**
+ * Sparse × Dense Multiplication (SpMM)
+ * Time Complexity: O(nnz(A) × n / threads)
+ * Space Complexity: O(threads)
+ * 
+ * Algorithm Steps:
+ * 1. Split the rows of A between threads by nonzero count
+ * 2. For each row i, clear C[i] and, for every nonzero A[i][k], add
+ *    A[i][k] × row k of B into it
+ * 
+ * Memory Optimization:
+ * - Only nonzeros of A are visited; no per-element zero test
+ * - Rows of B and C are streamed with unit stride
+ */
+void csrDenseMultiply(const CsrMatrix& A, long long** B, long long** C, int n, int numThreads = 0, long long alpha = 1, long long beta = 0) {
+    if (numThreads <= 0) numThreads = defaultThreadCount();
+    const std::vector<int> bounds = balancedCsrRowSplit(A, numThreads);
+    parallelFor(0, numThreads, [&](int partBegin, int partEnd) {
+        for (int i = bounds[partBegin]; i < bounds[partEnd]; i++) {
+            long long* cRow = C[i];
+            scaleRow(cRow, 0, n, beta);
+            for (int p = A.rowPtr[i]; p < A.rowPtr[i + 1]; p++) {
+                const long long a = alpha * A.values[p];
+                const long long* bRow = B[A.colIdx[p]];
+                for (int j = 0; j < n; j++) {
+                    cRow[j] += a * bRow[j];
+                }
+            }
+        }
+    }, numThreads);
+}
+
+/**
+ * Sparse × Sparse Multiplication (Gustavson SpGEMM)
+ * Time Complexity: O(flops / threads), flops = Σ over nonzeros A[i][k] of nnz(B row k)
+ * Space Complexity: O(nnz(C) + threads × B.cols)
+ * 
+ * Algorithm Steps:
+ * 1. Count the flops of every row of C and split rows between threads so
+ *    each part gets about the same number
+ * 2. Symbolic pass: for each row i, mark the distinct columns reached
+ *    through the rows of B selected by row i of A, giving nnz(C row i);
+ *    prefix-sum into C.rowPtr and allocate C exactly once
+ * 3. Numeric pass: accumulate row i in a per-thread sparse accumulator
+ *    (dense value array + marker + list of touched columns), then write
+ *    the touched columns in increasing order with their sums
+ * 
+ * Entries whose contributions cancel to zero are kept as explicit zeros,
+ * since the symbolic pass fixes the pattern before any value is known.
+ * 
+ * Memory Optimization:
+ * - Output sized exactly by the symbolic pass, no reallocation
+ * - Accumulators are reset through the touched list, never cleared in full
+ * - Markers hold row numbers, so they never need clearing between rows
+ */
+CsrMatrix csrMultiply(const CsrMatrix& A, const CsrMatrix& B, int numThreads = 0) {
+    if (numThreads <= 0) numThreads = defaultThreadCount();
+    CsrMatrix C;
+    C.rows = A.rows;
+    C.cols = B.cols;
+    C.rowPtr.assign(A.rows + 1, 0);
+
+    std::vector<long long> prefixFlops(A.rows + 1, 0);
+    for (int i = 0; i < A.rows; i++) {
+        long long flops = 0;
+        for (int p = A.rowPtr[i]; p < A.rowPtr[i + 1]; p++) {
+            const int k = A.colIdx[p];
+            flops += B.rowPtr[k + 1] - B.rowPtr[k];
+        }
+        prefixFlops[i + 1] = prefixFlops[i] + flops;
+    }
+    const std::vector<int> bounds = balancedRowSplit(prefixFlops, A.rows, numThreads);
+
+    // Symbolic pass
+    parallelFor(0, numThreads, [&](int partBegin, int partEnd) {
+        std::vector<int> marker(B.cols, -1);
+        for (int i = bounds[partBegin]; i < bounds[partEnd]; i++) {
+            int count = 0;
+            for (int p = A.rowPtr[i]; p < A.rowPtr[i + 1]; p++) {
+                const int k = A.colIdx[p];
+                for (int q = B.rowPtr[k]; q < B.rowPtr[k + 1]; q++) {
+                    const int j = B.colIdx[q];
+                    if (marker[j] != i) {
+                        marker[j] = i;
+                        count++;
+                    }
+                }
+            }
+            C.rowPtr[i + 1] = count;
+        }
+    }, numThreads);
+    for (int i = 0; i < A.rows; i++) C.rowPtr[i + 1] += C.rowPtr[i];
+    C.colIdx.resize(C.rowPtr[A.rows]);
+    C.values.resize(C.rowPtr[A.rows]);
+
+    // Numeric pass
+    parallelFor(0, numThreads, [&](int partBegin, int partEnd) {
+        std::vector<long long> accumulator(B.cols, 0);
+        std::vector<int> marker(B.cols, -1);
+        std::vector<int> touched;
+        for (int i = bounds[partBegin]; i < bounds[partEnd]; i++) {
+            touched.clear();
+            for (int p = A.rowPtr[i]; p < A.rowPtr[i + 1]; p++) {
+                const int k = A.colIdx[p];
+                const long long a = A.values[p];
+                for (int q = B.rowPtr[k]; q < B.rowPtr[k + 1]; q++) {
+                    const int j = B.colIdx[q];
+                    if (marker[j] != i) {
+                        marker[j] = i;
+                        accumulator[j] = 0;
+                        touched.push_back(j);
+                    }
+                    accumulator[j] += a * B.values[q];
+                }
+            }
+            std::sort(touched.begin(), touched.end());
+            int out = C.rowPtr[i];
+            for (int j : touched) {
+                C.colIdx[out] = j;
+                C.values[out] = accumulator[j];
+                out++;
+            }
+        }
+    }, numThreads);
+    return C;
+}
+
+/**
+ * Masked Sparse × Sparse Multiplication
+ * Time Complexity: O(Σ over A(i, k) of min(|B(k,:) in span(M(i,:))|,
+ *                  |M(i,:)| × log |B(k,:)|) / threads)
+ * Space Complexity: O(nnz(mask) + threads × B.cols)
+ * 
+ * Algorithm Steps:
+ * 1. Split rows between threads by unmasked flop count, as in csrMultiply
+ * 2. For row i, mark the columns of mask row i in a per-thread marker
+ * 3. For each A[i][k], intersect B row k with mask row i, whichever way
+ *    is cheaper (both are sorted by column):
+ *    - Probe: binary-search each mask column in B row k, advancing the
+ *      lower bound, when the mask row is short next to B row k
+ *    - Scan: walk only the entries of B row k between the first and last
+ *      mask column, accumulating those whose column is marked
+ *    Products outside the mask are skipped, not computed and dropped
+ * 4. Emit the mask columns of row i that received a contribution, in the
+ *    mask's column order
+ * 
+ * The result's pattern is a subset of the mask's, so the output is sized
+ * from the mask up front and compacted once at the end.
+ * 
+ * Memory Optimization:
+ * - Nothing outside the mask is ever stored
+ * - Marker and accumulator rows are reused across rows without clearing
+ */
+CsrMatrix csrMaskedMultiply(const CsrMatrix& A, const CsrMatrix& B, const CsrMatrix& mask, int numThreads = 0) {
+    if (numThreads <= 0) numThreads = defaultThreadCount();
+    std::vector<long long> prefixFlops(A.rows + 1, 0);
+    for (int i = 0; i < A.rows; i++) {
+        long long flops = 0;
+        for (int p = A.rowPtr[i]; p < A.rowPtr[i + 1]; p++) {
+            const int k = A.colIdx[p];
+            flops += B.rowPtr[k + 1] - B.rowPtr[k];
+        }
+        prefixFlops[i + 1] = prefixFlops[i] + flops;
+    }
+    const std::vector<int> bounds = balancedRowSplit(prefixFlops, A.rows, numThreads);
+
+    // Rows are first written at the mask's offsets, then compacted
+    std::vector<int> counts(A.rows, 0);
+    std::vector<int> columns(mask.colIdx.size());
+    std::vector<long long> values(mask.colIdx.size());
+    parallelFor(0, numThreads, [&](int partBegin, int partEnd) {
+        std::vector<long long> accumulator(B.cols, 0);
+        std::vector<int> marker(B.cols, -1);
+        std::vector<char> hit(B.cols, 0);
+        for (int i = bounds[partBegin]; i < bounds[partEnd]; i++) {
+            if (mask.rowPtr[i] == mask.rowPtr[i + 1]) continue;
+            for (int p = mask.rowPtr[i]; p < mask.rowPtr[i + 1]; p++) {
+                const int j = mask.colIdx[p];
+                marker[j] = i;
+                accumulator[j] = 0;
+                hit[j] = 0;
+            }
+            const int maskCount = mask.rowPtr[i + 1] - mask.rowPtr[i];
+            const int firstColumn = mask.colIdx[mask.rowPtr[i]];
+            const int lastColumn = mask.colIdx[mask.rowPtr[i + 1] - 1];
+            for (int p = A.rowPtr[i]; p < A.rowPtr[i + 1]; p++) {
+                const int k = A.colIdx[p];
+                const long long a = A.values[p];
+                const auto rowBegin = B.colIdx.begin() + B.rowPtr[k];
+                const auto rowEnd = B.colIdx.begin() + B.rowPtr[k + 1];
+                const int length = B.rowPtr[k + 1] - B.rowPtr[k];
+                if (maskCount * std::log2(length + 1.0) < length) {
+                    auto cursor = rowBegin;
+                    for (int m = mask.rowPtr[i]; m < mask.rowPtr[i + 1] && cursor != rowEnd; m++) {
+                        const int j = mask.colIdx[m];
+                        cursor = std::lower_bound(cursor, rowEnd, j);
+                        if (cursor != rowEnd && *cursor == j) {
+                            accumulator[j] += a * B.values[cursor - B.colIdx.begin()];
+                            hit[j] = 1;
+                        }
+                    }
+                    continue;
+                }
+                for (auto cursor = std::lower_bound(rowBegin, rowEnd, firstColumn); cursor != rowEnd && *cursor <= lastColumn; ++cursor) {
+                    const int j = *cursor;
+                    if (marker[j] == i) {
+                        accumulator[j] += a * B.values[cursor - B.colIdx.begin()];
+                        hit[j] = 1;
+                    }
+                }
+            }
+            int out = mask.rowPtr[i];
+            for (int p = mask.rowPtr[i]; p < mask.rowPtr[i + 1]; p++) {
+                const int j = mask.colIdx[p];
+                if (hit[j]) {
+                    columns[out] = j;
+                    values[out] = accumulator[j];
+                    out++;
+                }
+            }
+            counts[i] = out - mask.rowPtr[i];
+        }
+    }, numThreads);
+
+    CsrMatrix C;
+    C.rows = A.rows;
+    C.cols = B.cols;
+    C.rowPtr.assign(A.rows + 1, 0);
+    for (int i = 0; i < A.rows; i++) C.rowPtr[i + 1] = C.rowPtr[i] + counts[i];
+    C.colIdx.resize(C.rowPtr[A.rows]);
+    C.values.resize(C.rowPtr[A.rows]);
+    for (int i = 0; i < A.rows; i++) {
+        std::copy(columns.begin() + mask.rowPtr[i], columns.begin() + mask.rowPtr[i] + counts[i], C.colIdx.begin() + C.rowPtr[i]);
+        std::copy(values.begin() + mask.rowPtr[i], values.begin() + mask.rowPtr[i] + counts[i], C.values.begin() + C.rowPtr[i]);
+    }
+    return C;
+}
+
+/**
+ * Strictly lower triangle of a matrix, with every stored value set to 1.
+ */
+CsrMatrix csrStrictlyLower(const CsrMatrix& matrix) {
+    CsrMatrix lower;
+    lower.rows = matrix.rows;
+    lower.cols = matrix.cols;
+    lower.rowPtr.assign(matrix.rows + 1, 0);
+    for (int i = 0; i < matrix.rows; i++) {
+        for (int p = matrix.rowPtr[i]; p < matrix.rowPtr[i + 1]; p++) {
+            if (matrix.colIdx[p] < i) {
+                lower.colIdx.push_back(matrix.colIdx[p]);
+                lower.values.push_back(1);
+            }
+        }
+        lower.rowPtr[i + 1] = static_cast<int>(lower.colIdx.size());
+    }
+    return lower;
+}
+
+/**
+ * Triangle Counting
+ * Time Complexity: O(Σ over edges (i, k) of deg_L(k) / threads)
+ * Space Complexity: O(nnz(L) + threads × n)
+ * 
+ * Algorithm Steps:
+ * 1. Take L, the strictly lower triangle of the symmetric adjacency matrix
+ * 2. Compute (L × L) .* L with csrMaskedMultiply: entry (i, j) counts the
+ *    vertices k with i > k > j adjacent to both, i.e. the triangles whose
+ *    largest vertex is i and smallest is j
+ * 3. The sum of all entries counts each triangle exactly once
+ * 
+ * Equivalent to trace(A³) / 6, without ever forming A² or A³.
+ */
+long long countTriangles(const CsrMatrix& adjacency, int numThreads = 0) {
+    const CsrMatrix lower = csrStrictlyLower(adjacency);
+    const CsrMatrix paths = csrMaskedMultiply(lower, lower, lower, numThreads);
+    long long triangles = 0;
+    for (long long value : paths.values) triangles += value;
+    return triangles;
+}
+
+/**
+ * Density below which multiplying through CSR beats the dense engines.
+ * CSR does nnz(A) × n unit-stride updates; the dense kernels do n³ but
+ * with register blocking and SIMD, which wins back roughly a factor of ten.
+ */
+const double SPARSE_DENSITY_THRESHOLD = 0.1;
+
+/**
+ * Engine chosen by matrixMultiplyAuto.
+ */
+enum class AutoEngine { Sparse, ExactDouble, Blocked };
+
+/**
+ * Density-Based Engine Selection
+ * Time Complexity: O(n²) to decide, plus the chosen engine
+ * Space Complexity: that of the chosen engine
+ * 
+ * Algorithm Steps:
+ * 1. Measure the density of A
+ * 2. Below SPARSE_DENSITY_THRESHOLD, convert A to CSR and use csrDenseMultiply
+ * 3. Otherwise use the exact double engine, which falls back to the
+ *    blocked integer engine when its bound does not hold
+ */
+AutoEngine matrixMultiplyAuto(long long** A, long long** B, long long** C, int n, int numThreads = 0,
+                              long long alpha = 1, long long beta = 0) {
+    if (matrixDensity(A, n, n) < SPARSE_DENSITY_THRESHOLD) {
+        csrDenseMultiply(denseToCsr(A, n, n, numThreads), B, C, n, numThreads, alpha, beta);
+        return AutoEngine::Sparse;
+    }
+    return matrixMultiplyExactDouble(A, B, C, n, numThreads, alpha, beta) ? AutoEngine::ExactDouble : AutoEngine::Blocked;
+}
+
+/**
+ * Triangle of a symmetric result: entries with j <= i, or with j >= i.
+ */
+enum class Triangle { Lower, Upper };
+
+/**
+ * Copy one triangle of a symmetric matrix onto the other.
+ * Time Complexity: O(n² / threads)
+ * Space Complexity: O(1)
+ */
+void mirrorTriangle(long long** C, int n, Triangle source, int numThreads = 0) {
+    parallelFor(0, n, [&](int rowBegin, int rowEnd) {
+        for (int i = rowBegin; i < rowEnd; i++) {
+            if (source == Triangle::Lower) {
+                for (int j = i + 1; j < n; j++) C[i][j] = C[j][i];
+            } else {
+                for (int j = 0; j < i; j++) C[i][j] = C[j][i];
+            }
+        }
+    }, numThreads);
+}
+
+/**
+ * Symmetric Rank-k Update (SYRK)
+ * Time Complexity: O(n³ / 2 / threads)
+ * Space Complexity: O(n²) for A^T
+ * 
+ * Computes one triangle of C = alpha × A × A^T + beta × C, then
+ * optionally mirrors it.
+ * 
+ * Algorithm Steps:
+ * 1. Transpose A once so the product reads like A × B for the tile kernel;
+ *    alpha is folded into this private copy, and beta scales the
+ *    triangle of C before the kernel adds into it
+ * 2. Split C into blocks of SEMIRING_BLOCK_ROWS rows; a block row only
+ *    visits the column tiles that reach the requested triangle, so the
+ *    number of tiles grows linearly down (lower) or up (upper) the matrix
+ * 3. Split block rows between threads by that tile count rather than by
+ *    row count, so threads get equal work despite the triangular shape
+ * 4. Multiply the tiles with multiplyTileSemiring, exactly as
+ *    matrixMultiplyBlocked does
+ * 5. Mirror the triangle if requested
+ * 
+ * Diagonal blocks are computed whole; without mirroring the entries they
+ * spill into the other triangle are saved and restored, so that triangle
+ * of C is left untouched.
+ * 
+ * Memory Optimization:
+ * - Half the multiply-adds of a general product, with the same blocking
+ */
+void matrixMultiplySyrk(long long** A, long long** C, int n, Triangle uplo = Triangle::Lower, bool mirror = true,
+                        int numThreads = 0, long long alpha = 1, long long beta = 0) {
+    if (numThreads <= 0) numThreads = defaultThreadCount();
+    long long** At = allocateMatrix(n, n, numThreads);
+    transposeMatrix(A, At, n, n, numThreads);
+    if (alpha != 1) {
+        parallelFor(0, n, [&](int rowBegin, int rowEnd) {
+            for (int k = rowBegin; k < rowEnd; k++) {
+                for (int j = 0; j < n; j++) At[k][j] *= alpha;
+            }
+        }, numThreads);
+    }
+
+    const int rowBlocks = (n + SEMIRING_BLOCK_ROWS - 1) / SEMIRING_BLOCK_ROWS;
+    auto columnRange = [&](int block, int& j0, int& j1) {
+        const int i0 = block * SEMIRING_BLOCK_ROWS;
+        const int i1 = std::min(n, i0 + SEMIRING_BLOCK_ROWS);
+        j0 = uplo == Triangle::Lower ? 0 : i0;
+        j1 = uplo == Triangle::Lower ? i1 : n;
+    };
+    std::vector<long long> prefixWork(rowBlocks + 1, 0);
+    for (int block = 0; block < rowBlocks; block++) {
+        int j0, j1;
+        columnRange(block, j0, j1);
+        prefixWork[block + 1] = prefixWork[block] + (j1 - j0);
+    }
+    const std::vector<int> bounds = balancedRowSplit(prefixWork, rowBlocks, numThreads);
+
+    parallelFor(0, numThreads, [&](int partBegin, int partEnd) {
+        std::vector<long long> spill;
+        for (int block = bounds[partBegin]; block < bounds[partEnd]; block++) {
+            const int i0 = block * SEMIRING_BLOCK_ROWS;
+            const int i1 = std::min(n, i0 + SEMIRING_BLOCK_ROWS);
+            int jBegin, jEnd;
+            columnRange(block, jBegin, jEnd);
+            // Entries of the diagonal block that lie in the other triangle
+            auto forEachSpill = [&](auto visit) {
+                for (int i = i0; i < i1; i++) {
+                    const int s0 = uplo == Triangle::Lower ? i + 1 : i0;
+                    const int s1 = uplo == Triangle::Lower ? i1 : i;
+                    for (int j = s0; j < s1; j++) visit(C[i][j]);
+                }
+            };
+            if (!mirror) {
+                spill.clear();
+                forEachSpill([&](long long& value) { spill.push_back(value); });
+            }
+            for (int i = i0; i < i1; i++) {
+                scaleRow(C[i], jBegin, jEnd, beta);
+            }
+            for (int k0 = 0; k0 < n; k0 += SEMIRING_BLOCK_DEPTH) {
+                const int k1 = std::min(n, k0 + SEMIRING_BLOCK_DEPTH);
+                for (int j0 = jBegin; j0 < jEnd; j0 += SEMIRING_BLOCK_COLS) {
+                    const int j1 = std::min(jEnd, j0 + SEMIRING_BLOCK_COLS);
+                    multiplyTileSemiring<PlusTimesSemiring>(A, At, C, i0, i1, k0, k1, j0, j1);
+                }
+            }
+            if (!mirror) {
+                size_t next = 0;
+                forEachSpill([&](long long& value) { value = spill[next++]; });
+            }
+        }
+    }, numThreads);
+    freeMatrix(At);
+
+    if (mirror) mirrorTriangle(C, n, uplo, numThreads);
+}
+
+/**
+ * Data cache sizes in bytes, as reported by the OS where available.
+ */
+struct CacheSizes {
+    long l1 = 32 * 1024;
+    long l2 = 1024 * 1024;
+    long l3 = 8 * 1024 * 1024;
+};
+
+CacheSizes detectCacheSizes() {
+    CacheSizes sizes;
+#if defined(_SC_LEVEL1_DCACHE_SIZE)
+    const long l1 = sysconf(_SC_LEVEL1_DCACHE_SIZE);
+    const long l2 = sysconf(_SC_LEVEL2_CACHE_SIZE);
+    const long l3 = sysconf(_SC_LEVEL3_CACHE_SIZE);
+    if (l1 > 0) sizes.l1 = l1;
+    if (l2 > 0) sizes.l2 = l2;
+    if (l3 > 0) sizes.l3 = l3;
+#endif
+    return sizes;
+}
+
+/**
+ * Kernel that multiplies the leaves of a plan.
+ */
+enum class LeafKernel { Sparse, Narrow, ExactDouble, Blocked };
+
+/**
+ * How a plan spends its threads: all of them inside every leaf product,
+ * or one per product across the seven products of the top Winograd level.
+ */
+enum class PlanParallelism { WithinLeaves, AcrossProducts };
+
+/**
+ * Execution Plan for one multiplication
+ * winogradLevels levels of Strassen-Winograd recursion, then leafKernel on
+ * matrices of leafSize; blockDepth is the depth block of the double leaf.
+ */
+struct MultiplyPlan {
+    int n = 0;
+    int winogradLevels = 0;
+    int leafSize = 0;
+    LeafKernel leafKernel = LeafKernel::Blocked;
+    PlanParallelism parallelism = PlanParallelism::WithinLeaves;
+    int numThreads = 1;
+    int blockDepth = EXACT_BLOCK_DEPTH;
+};
+
+const char* leafKernelName(LeafKernel kernel) {
+    switch (kernel) {
+        case LeafKernel::Sparse: return "CSR x dense";
+        case LeafKernel::Narrow: return "narrow integer";
+        case LeafKernel::ExactDouble: return "exact double";
+        case LeafKernel::Blocked: return "blocked";
+    }
+    return "unknown";
+}
+
+/**
+ * Multiply-adds per unit time of a leaf kernel, relative to the exact
+ * double kernel, as measured at n = 1024 on AVX2: the narrow kernel packs
+ * twice as many products per instruction, the blocked one has no 64-bit
+ * vector multiply. Used to weigh the planned product against engines
+ * built on the double kernel.
+ */
+double leafKernelThroughput(LeafKernel kernel) {
+    switch (kernel) {
+        case LeafKernel::Narrow: return 2.0;
+        case LeafKernel::Blocked: return 0.25;
+        case LeafKernel::Sparse:
+        case LeafKernel::ExactDouble: return 1.0;
+    }
+    return 1.0;
+}
+
+/**
+ * Smallest leaf worth one more Winograd level. A level trades one eighth
+ * of the leaf work for fifteen O(n²) additions over memory, so the faster
+ * the leaf kernel, the larger the leaf must be before that pays.
+ */
+int minimumWinogradLeaf(LeafKernel kernel) {
+    switch (kernel) {
+        case LeafKernel::Sparse: return INT_MAX;  // Sums of sparse blocks fill in
+        case LeafKernel::Narrow: return 1024;
+        case LeafKernel::ExactDouble: return 512;
+        case LeafKernel::Blocked: return 256;
+    }
+    return INT_MAX;
+}
+
+/**
+ * Multiply Planner
+ * Time Complexity: O(n²) to inspect the operands
+ * Space Complexity: O(1)
+ * 
+ * Algorithm Steps:
+ * 1. Measure the density of A and the value ranges of A and B
+ * 2. Pick the leaf kernel the data allows, fastest first: CSR below
+ *    SPARSE_DENSITY_THRESHOLD, then narrow integers, then exact double
+ *    (via the 2^53 bound), then the blocked integer kernel
+ * 3. Add Winograd levels while
+ *    - n stays even (the recursion halves exactly, so at most the number
+ *      of trailing zero bits of n),
+ *    - the leaf stays at or above minimumWinogradLeaf for its kernel, and
+ *    - the leaf kernel stays valid: each level's operand sums can grow
+ *      magnitudes by up to 4x on each side
+ * 4. Size the double kernel's depth block so a depth block of the leaf's
+ *    B uses at most half of L2
+ * 5. With at least seven threads and leaves too small to split well
+ *    across all of them, run the seven top-level products side by side
+ */
+MultiplyPlan planMultiply(long long** A, long long** B, int n, int numThreads = 0, const CacheSizes& caches = detectCacheSizes()) {
+    MultiplyPlan plan;
+    plan.n = n;
+    plan.numThreads = numThreads > 0 ? numThreads : defaultThreadCount();
+    plan.leafSize = n;
+    if (matrixDensity(A, n, n) < SPARSE_DENSITY_THRESHOLD) {
+        plan.leafKernel = LeafKernel::Sparse;
+        return plan;
+    }
+
+    const ValueRange rangeA = matrixValueRange(A, n, n, plan.numThreads);
+    const ValueRange rangeB = matrixValueRange(B, n, n, plan.numThreads);
+    const double maxA = std::max(std::fabs(static_cast<double>(rangeA.minValue)), std::fabs(static_cast<double>(rangeA.maxValue)));
+    const double maxB = std::max(std::fabs(static_cast<double>(rangeB.minValue)), std::fabs(static_cast<double>(rangeB.maxValue)));
+    // Leaf kernel usable after `levels` levels of growth, fastest first
+    auto leafFor = [&](int levels) {
+        const double growth = std::pow(4.0, levels);
+        const int leafSize = n >> levels;
+        const ValueRange grownA = {static_cast<long long>(-maxA * growth), static_cast<long long>(maxA * growth)};
+        const ValueRange grownB = {static_cast<long long>(-maxB * growth), static_cast<long long>(maxB * growth)};
+        if (narrowElementFor(grownA, grownB) != NarrowElement::None) return LeafKernel::Narrow;
+        if (leafSize * maxA * growth * maxB * growth < 9007199254740992.0 * (1.0 - 1e-9)) return LeafKernel::ExactDouble;
+        return LeafKernel::Blocked;
+    };
+
+    plan.leafKernel = leafFor(0);
+    while ((plan.leafSize & 1) == 0 && plan.leafSize / 2 >= minimumWinogradLeaf(plan.leafKernel) &&
+           leafFor(plan.winogradLevels + 1) == plan.leafKernel) {
+        plan.winogradLevels++;
+        plan.leafSize /= 2;
+    }
+
+    const long ld = (plan.leafSize + EXACT_MICRO_COLS - 1) / EXACT_MICRO_COLS * EXACT_MICRO_COLS;
+    const long depth = caches.l2 / 2 / (ld * static_cast<long>(sizeof(double)));
+    plan.blockDepth = static_cast<int>(std::max(32L, std::min(1024L, depth / 8 * 8)));
+
+    const long long leafRowsPerThread = plan.leafSize / plan.numThreads;
+    if (plan.winogradLevels > 0 && plan.numThreads >= 7 && leafRowsPerThread < 2 * SEMIRING_BLOCK_ROWS) {
+        plan.parallelism = PlanParallelism::AcrossProducts;
+    }
+    return plan;
+}
+
+/**
+ * Multiply one leaf with the plan's kernel. Narrow and double leaves
+ * re-check their own bounds and fall back to the blocked kernel, so a
+ * conservative plan can never produce a wrong result.
+ */
+void runPlanLeaf(const MultiplyPlan& plan, long long** A, long long** B, long long** C, int n, int numThreads, long long alpha, long long beta) {
+    switch (plan.leafKernel) {
+        case LeafKernel::Sparse:
+            csrDenseMultiply(denseToCsr(A, n, n, numThreads), B, C, n, numThreads, alpha, beta);
+            break;
+        case LeafKernel::Narrow:
+            matrixMultiplyNarrow(A, B, C, n, numThreads, alpha, beta);
+            break;
+        case LeafKernel::ExactDouble:
+            matrixMultiplyExactDouble(A, B, C, n, Transpose::None, Transpose::None, numThreads, alpha, beta, plan.blockDepth);
+            break;
+        case LeafKernel::Blocked:
+            matrixMultiplyBlocked(A, B, C, n, numThreads, alpha, beta);
+            break;
+    }
+}
+
+/**
+ * Row-pointer view of the (r, c) quadrant of a 2h × 2w matrix. Every
+ * engine indexes M[i][j], so a view is a zero-copy operand.
+ */
+template <typename T>
+std::vector<T*> quadrantView(T** M, int halfRows, int halfCols, int r, int c) {
+    std::vector<T*> rows(halfRows);
+    for (int i = 0; i < halfRows; i++) rows[i] = M[r * halfRows + i] + c * halfCols;
+    return rows;
+}
+
+template <typename T>
+std::vector<T*> quadrantView(T** M, int half, int r, int c) {
+    return quadrantView(M, half, half, r, c);
+}
+
+/**
+ * Dense matrix of any element type in the library's row-pointer layout:
+ * one zero-initialized element block and a row table. Release with
+ * freeElementMatrix.
+ */
+template <typename T>
+T** allocateElementMatrix(int rows, int cols) {
+    T** matrix = new T*[rows > 0 ? rows : 1];
+    T* data = new T[static_cast<size_t>(rows > 0 ? rows : 1) * (cols > 0 ? cols : 1)]();
+    for (int i = 0; i < rows; i++) matrix[i] = data + static_cast<size_t>(i) * cols;
+    if (rows == 0) matrix[0] = data;
+    return matrix;
+}
+
+template <typename T>
+void freeElementMatrix(T** matrix) {
+    delete[] matrix[0];
+    delete[] matrix;
+}
+
+/**
+ * Element arithmetic of the integer engines' Winograd levels. The field
+ * solvers pass their field instead, which has the same add and subtract.
+ */
+struct IntegerArithmetic {
+    using Element = long long;
+
+    long long add(long long a, long long b) const { return a + b; }
+    long long subtract(long long a, long long b) const { return a - b; }
+};
+
+/**
+ * One level of Strassen-Winograd over an m × k by k × n product: quadrant
+ * views of A, B and C, the operand sums S (rows × depth) and T (depth ×
+ * cols), and the seven products M[p] = lhs[p] × rhs[p] (rows × cols)
+ * still to be filled in. half is rows, the size of a square level.
+ */
+template <typename Arithmetic>
+struct WinogradLevelOf {
+    using Element = typename Arithmetic::Element;
+
+    int half = 0;
+    int rows = 0, depth = 0, cols = 0;
+    std::vector<Element*> a[2][2], b[2][2], c[2][2];
+    Element** S[4];
+    Element** T[4];
+    Element** M[7];
+    Element** lhs[7];
+    Element** rhs[7];
+};
+
+using WinogradLevel = WinogradLevelOf<IntegerArithmetic>;
+
+// Integer temporaries come from allocateMatrix, so they get its page placement
+template <typename Element>
+Element** allocateLevelMatrix(int rows, int cols, int numThreads) {
+    if constexpr (std::is_same_v<Element, long long>) {
+        return allocateMatrix(rows, cols, numThreads);
+    } else {
+        (void)numThreads;
+        return allocateElementMatrix<Element>(rows, cols);
+    }
+}
+
+template <typename Element>
+void freeLevelMatrix(Element** matrix) {
+    if constexpr (std::is_same_v<Element, long long>) {
+        freeMatrix(matrix);
+    } else {
+        freeElementMatrix(matrix);
+    }
+}
+
+/**
+ * Take quadrant views of A, B and C (no copies) and form
+ * S1 = A21 + A22, S2 = S1 - A11, S3 = A11 - A21, S4 = A12 - S2 and
+ * T1 = B12 - B11, T2 = B22 - T1, T3 = B22 - B12, T4 = T2 - B21; the
+ * products are M1 = A11 B11, M2 = A12 B21, M3 = S4 B22, M4 = A22 T4,
+ * M5 = S1 T1, M6 = S2 T2, M7 = S3 T3. m, k and n must be even.
+ * 
+ * The four S sums are one pass over the rows of A's halves and the four
+ * T sums one pass over B's, each split between threads.
+ */
+template <typename Arithmetic>
+void beginWinogradLevel(WinogradLevelOf<Arithmetic>& level, const Arithmetic& arithmetic,
+                        typename Arithmetic::Element** A, typename Arithmetic::Element** B,
+                        typename Arithmetic::Element** C, int m, int k, int n, int numThreads) {
+    using Element = typename Arithmetic::Element;
+    const int hm = m / 2, hk = k / 2, hn = n / 2;
+    level.half = hm;
+    level.rows = hm;
+    level.depth = hk;
+    level.cols = hn;
+    for (int r = 0; r < 2; r++) {
+        for (int col = 0; col < 2; col++) {
+            level.a[r][col] = quadrantView(A, hm, hk, r, col);
+            level.b[r][col] = quadrantView(B, hk, hn, r, col);
+            level.c[r][col] = quadrantView(C, hm, hn, r, col);
+        }
+    }
+    for (int t = 0; t < 4; t++) {
+        level.S[t] = allocateLevelMatrix<Element>(hm, hk, numThreads);
+        level.T[t] = allocateLevelMatrix<Element>(hk, hn, numThreads);
+    }
+    for (int t = 0; t < 7; t++) level.M[t] = allocateLevelMatrix<Element>(hm, hn, numThreads);
+
+    auto& a = level.a;
+    auto& b = level.b;
+    Element** const* S = level.S;
+    Element** const* T = level.T;
+    parallelFor(0, hm, [&](int rowBegin, int rowEnd) {
+        for (int i = rowBegin; i < rowEnd; i++) {
+            for (int j = 0; j < hk; j++) {
+                S[0][i][j] = arithmetic.add(a[1][0][i][j], a[1][1][i][j]);
+                S[1][i][j] = arithmetic.subtract(S[0][i][j], a[0][0][i][j]);
+                S[2][i][j] = arithmetic.subtract(a[0][0][i][j], a[1][0][i][j]);
+                S[3][i][j] = arithmetic.subtract(a[0][1][i][j], S[1][i][j]);
+            }
+        }
+    }, numThreads);
+    parallelFor(0, hk, [&](int rowBegin, int rowEnd) {
+        for (int i = rowBegin; i < rowEnd; i++) {
+            for (int j = 0; j < hn; j++) {
+                T[0][i][j] = arithmetic.subtract(b[0][1][i][j], b[0][0][i][j]);
+                T[1][i][j] = arithmetic.subtract(b[1][1][i][j], T[0][i][j]);
+                T[2][i][j] = arithmetic.subtract(b[1][1][i][j], b[0][1][i][j]);
+                T[3][i][j] = arithmetic.subtract(T[1][i][j], b[1][0][i][j]);
+            }
+        }
+    }, numThreads);
+
+    Element** const lhs[7] = {a[0][0].data(), a[0][1].data(), level.S[3], a[1][1].data(), level.S[0], level.S[1], level.S[2]};
+    Element** const rhs[7] = {b[0][0].data(), b[1][0].data(), b[1][1].data(), level.T[3], level.T[0], level.T[1], level.T[2]};
+    std::copy(lhs, lhs + 7, level.lhs);
+    std::copy(rhs, rhs + 7, level.rhs);
+}
+
+void beginWinogradLevel(WinogradLevel& level, long long** A, long long** B, long long** C, int n, int numThreads = 0) {
+    beginWinogradLevel(level, IntegerArithmetic(), A, B, C, n, n, n, numThreads);
+}
+
+/**
+ * Free the sums and products of a level without combining them.
+ */
+template <typename Arithmetic>
+void releaseWinogradLevel(WinogradLevelOf<Arithmetic>& level) {
+    for (int t = 0; t < 4; t++) {
+        freeLevelMatrix(level.S[t]);
+        freeLevelMatrix(level.T[t]);
+    }
+    for (int t = 0; t < 7; t++) freeLevelMatrix(level.M[t]);
+}
+
+/**
+ * Combine the seven products with U2 = M1 + M6, U3 = U2 + M7:
+ * C11 = M1 + M2, C12 = U2 + M5 + M3, C21 = U3 - M4, C22 = U3 + M5,
+ * handing each quadrant value to store(destination, value) — which is
+ * where the integer engines apply alpha and beta — then release the
+ * level's temporaries.
+ */
+template <typename Arithmetic, typename Store>
+void finishWinogradLevel(WinogradLevelOf<Arithmetic>& level, const Arithmetic& arithmetic, int numThreads, Store store) {
+    using Element = typename Arithmetic::Element;
+    Element** const* M = level.M;
+    auto& c = level.c;
+    parallelFor(0, level.rows, [&](int rowBegin, int rowEnd) {
+        for (int i = rowBegin; i < rowEnd; i++) {
+            for (int j = 0; j < level.cols; j++) {
+                const Element u2 = arithmetic.add(M[0][i][j], M[5][i][j]);
+                const Element u3 = arithmetic.add(u2, M[6][i][j]);
+                store(c[0][0][i][j], arithmetic.add(M[0][i][j], M[1][i][j]));
+                store(c[0][1][i][j], arithmetic.add(arithmetic.add(u2, M[4][i][j]), M[2][i][j]));
+                store(c[1][0][i][j], arithmetic.subtract(u3, M[3][i][j]));
+                store(c[1][1][i][j], arithmetic.add(u3, M[4][i][j]));
+            }
+        }
+    }, numThreads);
+    releaseWinogradLevel(level);
+}
+
+void finishWinogradLevel(WinogradLevel& level, int numThreads, long long alpha, long long beta) {
+    finishWinogradLevel(level, IntegerArithmetic(), numThreads,
+                        [alpha, beta](long long& destination, long long value) { storeScaled(destination, value, alpha, beta); });
+}
+
+/**
+ * Strassen-Winograd Recursion
+ * Time Complexity: O(7^L × leaf(n / 2^L) + n²)
+ * Space Complexity: O(n²) — fifteen half-size temporaries per level
+ * 
+ * Algorithm Steps:
+ * 1. Form the operand sums with beginWinogradLevel
+ * 2. Compute the seven products recursively, or with the leaf kernel at
+ *    the last level
+ * 3. Combine them into C with finishWinogradLevel
+ * 
+ * Winograd's form needs 15 additions per level against Strassen's 18.
+ */
+void winogradRecursive(const MultiplyPlan& plan, long long** A, long long** B, long long** C, int n, int levels,
+                       int numThreads, long long alpha, long long beta) {
+    if (levels == 0) {
+        runPlanLeaf(plan, A, B, C, n, numThreads, alpha, beta);
+        return;
+    }
+    WinogradLevel level;
+    beginWinogradLevel(level, A, B, C, n, numThreads);
+    const int half = level.half;
+    if (plan.parallelism == PlanParallelism::AcrossProducts && levels == plan.winogradLevels) {
+        parallelFor(0, 7, [&](int productBegin, int productEnd) {
+            for (int p = productBegin; p < productEnd; p++) {
+                winogradRecursive(plan, level.lhs[p], level.rhs[p], level.M[p], half, levels - 1, 1, 1, 0);
+            }
+        }, numThreads);
+    } else {
+        for (int p = 0; p < 7; p++) {
+            winogradRecursive(plan, level.lhs[p], level.rhs[p], level.M[p], half, levels - 1, numThreads, 1, 0);
+        }
+    }
+    finishWinogradLevel(level, numThreads, alpha, beta);
+}
+
+void executePlan(const MultiplyPlan& plan, long long** A, long long** B, long long** C, long long alpha = 1, long long beta = 0) {
+    winogradRecursive(plan, A, B, C, plan.n, plan.winogradLevels, plan.numThreads, alpha, beta);
+}
+
+/**
+ * Planned Matrix Multiplication
+ * The single entry point for callers: plans for the operands, the
+ * machine's threads and caches, then executes the plan.
+ */
+void matrixMultiply(long long** A, long long** B, long long** C, int n, int numThreads = 0, long long alpha = 1, long long beta = 0) {
+    executePlan(planMultiply(A, B, n, numThreads), A, B, C, alpha, beta);
+}
+
+const int SYRK_STRASSEN_CUTOFF = 256;
+
+/**
+ * Strassen-Based Symmetric Rank-k Update
+ * Time Complexity: about 2/3 of a Strassen product of the same size
+ * Space Complexity: O(n²) for two transposed quadrants per level
+ * 
+ * Algorithm Steps:
+ * 1. At or below SYRK_STRASSEN_CUTOFF, or for odd n, use matrixMultiplySyrk
+ * 2. Take quadrant views of A and C; for the lower triangle
+ *    - C11 = A11 × A11^T + A12 × A12^T and C22 = A21 × A21^T + A22 × A22^T
+ *      are themselves symmetric: recurse twice into each, the second call
+ *      accumulating with beta = 1, keeping only their triangles
+ *    - C21 = A21 × A11^T + A22 × A12^T is a general product: two calls to
+ *      the planned engine (matrixMultiply) on transposed quadrants, the
+ *      second accumulating
+ *    The upper triangle is symmetric, with C12 = A11 × A21^T + A12 × A22^T
+ * 3. Mirror the triangle if requested
+ * 
+ * With four half-size symmetric subproblems and two half-size fast
+ * products per level, the cost Y(n) = 4Y(n/2) + 2S(n/2) settles at
+ * two thirds of S(n), against one half for the classical SYRK. The
+ * general products get the planner's leaf kernels, Winograd levels and
+ * threads, and alpha and beta are applied where they are written, so no
+ * level allocates more than the two transposed quadrants.
+ */
+void syrkStrassenTriangle(long long** A, long long** C, int n, Triangle uplo, int numThreads, long long alpha, long long beta) {
+    if (n <= SYRK_STRASSEN_CUTOFF || n % 2 != 0) {
+        matrixMultiplySyrk(A, C, n, uplo, false, numThreads, alpha, beta);
+        return;
+    }
+    const int half = n / 2;
+    std::vector<long long*> a[2][2], c[2][2];
+    for (int r = 0; r < 2; r++) {
+        for (int col = 0; col < 2; col++) {
+            a[r][col] = quadrantView(A, half, r, col);
+            c[r][col] = quadrantView(C, half, r, col);
+        }
+    }
+
+    // Diagonal blocks: sum of two symmetric products, triangle only
+    for (int d = 0; d < 2; d++) {
+        syrkStrassenTriangle(a[d][0].data(), c[d][d].data(), half, uplo, numThreads, alpha, beta);
+        syrkStrassenTriangle(a[d][1].data(), c[d][d].data(), half, uplo, numThreads, alpha, 1);
+    }
+
+    // Off-diagonal block: row block x times column block y, transposed
+    const int x = uplo == Triangle::Lower ? 1 : 0;
+    const int y = 1 - x;
+    long long** Qt0 = allocateMatrix(half, half, numThreads);
+    long long** Qt1 = allocateMatrix(half, half, numThreads);
+    transposeMatrix(a[y][0].data(), Qt0, half, half, numThreads);
+    transposeMatrix(a[y][1].data(), Qt1, half, half, numThreads);
+    matrixMultiply(a[x][0].data(), Qt0, c[x][y].data(), half, numThreads, alpha, beta);
+    matrixMultiply(a[x][1].data(), Qt1, c[x][y].data(), half, numThreads, alpha, 1);
+    freeMatrix(Qt0);
+    freeMatrix(Qt1);
+}
+
+void matrixMultiplySyrkStrassen(long long** A, long long** C, int n, Triangle uplo = Triangle::Lower, bool mirror = true,
+                                int numThreads = 0, long long alpha = 1, long long beta = 0) {
+    syrkStrassenTriangle(A, C, n, uplo, numThreads, alpha, beta);
+    if (mirror) mirrorTriangle(C, n, uplo, numThreads);
+}
+
+/**
+ * Cost model for one step of a matrix chain, fitted to the rectangular
+ * engine: seconds ≈ perMultiplyAdd × m × k × n + perElement × (m × n + k × n).
+ * The second term covers what operation counts miss — writing C and
+ * streaming B once per row block — which dominates skinny products.
+ */
+struct ChainCostModel {
+    double perMultiplyAdd = 1.0;
+    double perElement = 0.0;
+
+    double stepCost(long long m, long long k, long long n) const {
+        return perMultiplyAdd * m * k * n + perElement * (m * n + k * n);
+    }
+};
+
+/**
+ * Time one m × k × n product on the rectangular engine, best of a few runs.
+ */
+double timeRectangularProduct(int m, int k, int n, int numThreads) {
+    long long** A = allocateMatrix(m, k, numThreads);
+    long long** B = allocateMatrix(k, n, numThreads);
+    long long** C = allocateMatrix(m, n, numThreads);
+    fillMatrixParallel(A, m, k, [](int i, int j) { return static_cast<long long>((i + j) % 7); }, numThreads);
+    fillMatrixParallel(B, k, n, [](int i, int j) { return static_cast<long long>((i * j) % 5); }, numThreads);
+    double best = 1e30;
+    for (int run = 0; run < 3; run++) {
+        auto start = std::chrono::high_resolution_clock::now();
+        matrixMultiplyRectangular(A, B, C, m, k, n, numThreads);
+        auto end = std::chrono::high_resolution_clock::now();
+        best = std::min(best, std::chrono::duration<double>(end - start).count());
+    }
+    freeMatrix(A);
+    freeMatrix(B);
+    freeMatrix(C);
+    return best;
+}
+
+/**
+ * Chain Cost Model Calibration
+ * Time Complexity: a few milliseconds of benchmark products
+ * Space Complexity: O(1) beyond the calibration matrices
+ * 
+ * Times a compute-bound cube and a memory-bound flat product on the
+ * engine the chain actually runs, and solves the 2 × 2 system for the
+ * two coefficients of ChainCostModel.
+ */
+ChainCostModel calibrateChainCostModel(int numThreads = 0) {
+    const int cube = 192;
+    const int flatOuter = 768;
+    const int flatInner = 4;
+    const double tCube = timeRectangularProduct(cube, cube, cube, numThreads);
+    const double tFlat = timeRectangularProduct(flatOuter, flatInner, flatOuter, numThreads);
+    // [ mkn  elems ] [a b]^T = t for both shapes
+    const double mkn1 = 1.0 * cube * cube * cube, e1 = 2.0 * cube * cube;
+    const double mkn2 = 1.0 * flatOuter * flatInner * flatOuter, e2 = 1.0 * flatOuter * flatOuter + 1.0 * flatInner * flatOuter;
+    const double det = mkn1 * e2 - mkn2 * e1;
+    ChainCostModel model;
+    model.perMultiplyAdd = std::max(1e-15, (tCube * e2 - tFlat * e1) / det);
+    model.perElement = std::max(0.0, (mkn1 * tFlat - mkn2 * tCube) / det);
+    return model;
+}
+
+/**
+ * Parenthesization of a chain: split[i][j] is the s at which the product
+ * of matrices i..j is split into (i..s)(s+1..j).
+ */
+struct ChainPlan {
+    std::vector<std::vector<int>> split;
+    double cost = 0.0;
+};
+
+/**
+ * Matrix Chain Ordering
+ * Time Complexity: O(k³) for k matrices
+ * Space Complexity: O(k²)
+ * 
+ * Classic interval dynamic program: cost[i][j] is the cheapest way to
+ * form matrices i..j, trying every split s and paying
+ * cost[i][s] + cost[s+1][j] + model.stepCost(dims[i], dims[s+1], dims[j+1]).
+ * Matrix i is dims[i] × dims[i+1].
+ */
+ChainPlan planMatrixChain(const std::vector<int>& dims, const ChainCostModel& model) {
+    const int count = static_cast<int>(dims.size()) - 1;
+    std::vector<std::vector<double>> cost(count, std::vector<double>(count, 0.0));
+    ChainPlan plan;
+    plan.split.assign(count, std::vector<int>(count, 0));
+    for (int length = 2; length <= count; length++) {
+        for (int i = 0; i + length - 1 < count; i++) {
+            const int j = i + length - 1;
+            cost[i][j] = 1e300;
+            for (int s = i; s < j; s++) {
+                const double candidate = cost[i][s] + cost[s + 1][j] + model.stepCost(dims[i], dims[s + 1], dims[j + 1]);
+                if (candidate < cost[i][j]) {
+                    cost[i][j] = candidate;
+                    plan.split[i][j] = s;
+                }
+            }
+        }
+    }
+    plan.cost = count > 0 ? cost[0][count - 1] : 0.0;
+    return plan;
+}
+
+/**
+ * Left-to-right evaluation, ((M0 M1) M2) ..., as a ChainPlan.
+ */
+ChainPlan leftToRightChain(const std::vector<int>& dims, const ChainCostModel& model) {
+    const int count = static_cast<int>(dims.size()) - 1;
+    ChainPlan plan;
+    plan.split.assign(count, std::vector<int>(count, 0));
+    for (int j = 1; j < count; j++) {
+        plan.split[0][j] = j - 1;
+        plan.cost += model.stepCost(dims[0], dims[j], dims[j + 1]);
+    }
+    return plan;
+}
+
+std::string chainParenthesization(const ChainPlan& plan, int i, int j) {
+    if (i == j) return "M" + std::to_string(i);
+    const int s = plan.split[i][j];
+    return "(" + chainParenthesization(plan, i, s) + " " + chainParenthesization(plan, s + 1, j) + ")";
+}
+
+/**
+ * Pool of intermediate buffers for chain evaluation. A released buffer is
+ * handed to the next request it is large enough for, so a chain allocates
+ * roughly as many buffers as it has live intermediates at once rather
+ * than one per step.
+ */
+class ChainBufferPool {
+public:
+    struct Buffer {
+        std::vector<long long> data;
+        std::vector<long long*> rows;
+    };
+
+    Buffer acquire(int rows, int cols) {
+        const size_t needed = static_cast<size_t>(rows) * cols;
+        Buffer buffer;
+        auto best = free_.end();
+        for (auto it = free_.begin(); it != free_.end(); ++it) {
+            if (it->capacity() >= needed && (best == free_.end() || it->capacity() < best->capacity())) best = it;
+        }
+        if (best != free_.end()) {
+            buffer.data = std::move(*best);
+            free_.erase(best);
+        }
+        buffer.data.resize(needed);
+        buffer.rows.resize(rows);
+        for (int r = 0; r < rows; r++) buffer.rows[r] = buffer.data.data() + static_cast<size_t>(r) * cols;
+        return buffer;
+    }
+
+    void release(Buffer& buffer) {
+        free_.push_back(std::move(buffer.data));
+        buffer.rows.clear();
+    }
+
+private:
+    std::vector<std::vector<long long>> free_;
+};
+
+/**
+ * Evaluate matrices i..j of the chain into `out` (dims[i] × dims[j+1]),
+ * post-order; each intermediate goes back to the pool as soon as the
+ * product that consumes it is done.
+ */
+void evaluateChain(const std::vector<long long**>& matrices, const std::vector<int>& dims, const ChainPlan& plan,
+                   int i, int j, long long** out, ChainBufferPool& pool, int numThreads) {
+    const int s = plan.split[i][j];
+    ChainBufferPool::Buffer left, right;
+    long long** lhs = matrices[i];
+    long long** rhs = matrices[j];
+    if (s > i) {
+        left = pool.acquire(dims[i], dims[s + 1]);
+        evaluateChain(matrices, dims, plan, i, s, left.rows.data(), pool, numThreads);
+        lhs = left.rows.data();
+    }
+    if (j > s + 1) {
+        right = pool.acquire(dims[s + 1], dims[j + 1]);
+        evaluateChain(matrices, dims, plan, s + 1, j, right.rows.data(), pool, numThreads);
+        rhs = right.rows.data();
+    }
+    matrixMultiplyRectangular(lhs, rhs, out, dims[i], dims[s + 1], dims[j + 1], numThreads);
+    if (s > i) pool.release(left);
+    if (j > s + 1) pool.release(right);
+}
+
+/**
+ * Matrix Chain Multiplication
+ * Time Complexity: that of the chosen parenthesization
+ * Space Complexity: the live intermediates, reused through ChainBufferPool
+ * 
+ * Multiplies matrices[0] × ... × matrices[k-1] (matrix i is
+ * dims[i] × dims[i+1]) in the order given by plan and returns a new
+ * dims[0] × dims[k] matrix; release it with freeMatrix.
+ */
+long long** multiplyMatrixChain(const std::vector<long long**>& matrices, const std::vector<int>& dims, const ChainPlan& plan,
+                                int numThreads = 0) {
+    const int count = static_cast<int>(matrices.size());
+    long long** result = allocateMatrix(dims[0], dims[count], numThreads);
+    if (count == 1) {
+        for (int r = 0; r < dims[0]; r++) std::copy(matrices[0][r], matrices[0][r] + dims[1], result[r]);
+        return result;
+    }
+    ChainBufferPool pool;
+    evaluateChain(matrices, dims, plan, 0, count - 1, result, pool, numThreads);
+    return result;
+}
+
+/**
+ * One pending rank-1 change u × v^T to an operand. Unit vectors, which
+ * every row and column replacement produces on one side, are kept as an
+ * index so applying them costs O(n) instead of a multiply.
+ */
+struct RankOneUpdate {
+    int uIndex = -1;              // u = e_uIndex when >= 0, else u holds n values
+    std::vector<long long> u;
+    int vIndex = -1;              // v = e_vIndex when >= 0, else v holds n values
+    std::vector<long long> v;
+};
+
+enum class ProductOperand { A, B };
+
+/**
+ * Product C = A × B kept current under changes to A or B. The operands
+ * are owned copies and always hold their latest values; C lags behind by
+ * the pending rank-1 updates, all to the same operand, which are applied
+ * in one batch when the product is read or the other operand changes.
+ */
+struct MaintainedProduct {
+    int n = 0;
+    int numThreads = 0;
+    long long** A = nullptr;
+    long long** B = nullptr;
+    long long** C = nullptr;
+    ProductOperand pendingOperand = ProductOperand::A;
+    std::vector<RankOneUpdate> pending;
+};
+
+MaintainedProduct createMaintainedProduct(long long** A, long long** B, int n, int numThreads = 0) {
+    MaintainedProduct product;
+    product.n = n;
+    product.numThreads = numThreads;
+    product.A = allocateMatrix(n, n, numThreads);
+    product.B = allocateMatrix(n, n, numThreads);
+    product.C = allocateMatrix(n, n, numThreads);
+    for (int i = 0; i < n; i++) {
+        std::copy(A[i], A[i] + n, product.A[i]);
+        std::copy(B[i], B[i] + n, product.B[i]);
+    }
+    matrixMultiply(product.A, product.B, product.C, n, numThreads);
+    return product;
+}
+
+void destroyMaintainedProduct(MaintainedProduct& product) {
+    freeMatrix(product.A);
+    freeMatrix(product.B);
+    freeMatrix(product.C);
+    product.A = product.B = product.C = nullptr;
+    product.pending.clear();
+}
+
+/**
+ * Apply Pending Updates
+ * Time Complexity: O(k × n²) for k dense updates; O(k × n) when one side
+ *                  of every update is a unit vector and the other is
+ *                  already a row or column of an operand
+ * Space Complexity: O(k × n)
+ * 
+ * Algorithm Steps (changes to A, ΔA = Σ u_t v_t^T, so ΔC = Σ u_t (v_t^T B)):
+ * 1. w_t = v_t^T B: row j of B for v_t = e_j; the dense v_t are stacked
+ *    into one k × n matrix and multiplied by B in a single rectangular call
+ * 2. For u_t = e_i add w_t to row i of C; the dense u_t are stacked and
+ *    C += U × W is one more rectangular call with beta = 1
+ * Changes to B (ΔC = Σ (A u_t) v_t^T) mirror this: x_t = A u_t is a column
+ * of A or one batched product, and unit v_t add x_t to a column of C.
+ * 
+ * Batching turns k separate O(n²) updates into two rectangular products
+ * with inner dimension k, which run at blocked-kernel speed.
+ */
+void flushPendingUpdates(MaintainedProduct& product) {
+    if (product.pending.empty()) return;
+    const int n = product.n;
+    const int threads = product.numThreads;
+    const std::vector<RankOneUpdate>& updates = product.pending;
+    const int count = static_cast<int>(updates.size());
+    const bool changesA = product.pendingOperand == ProductOperand::A;
+
+    // The side multiplied by the other operand: v for A changes, u for B changes
+    auto innerIndex = [&](const RankOneUpdate& t) { return changesA ? t.vIndex : t.uIndex; };
+    auto innerVector = [&](const RankOneUpdate& t) -> const std::vector<long long>& { return changesA ? t.v : t.u; };
+    auto outerIndex = [&](const RankOneUpdate& t) { return changesA ? t.uIndex : t.vIndex; };
+    auto outerVector = [&](const RankOneUpdate& t) -> const std::vector<long long>& { return changesA ? t.u : t.v; };
+
+    // Step 1: image of every inner vector through the other operand
+    std::vector<int> denseInner;
+    for (int t = 0; t < count; t++) {
+        if (innerIndex(updates[t]) < 0) denseInner.push_back(t);
+    }
+    std::vector<long long> images(static_cast<size_t>(count) * n);
+    auto image = [&](int t) { return images.data() + static_cast<size_t>(t) * n; };
+    for (int t = 0; t < count; t++) {
+        const int index = innerIndex(updates[t]);
+        if (index < 0) continue;
+        for (int r = 0; r < n; r++) image(t)[r] = changesA ? product.B[index][r] : product.A[r][index];
+    }
+    if (!denseInner.empty()) {
+        const int k = static_cast<int>(denseInner.size());
+        if (changesA) {
+            long long** V = allocateMatrix(k, n);
+            long long** W = allocateMatrix(k, n);
+            for (int d = 0; d < k; d++) {
+                const std::vector<long long>& inner = innerVector(updates[denseInner[d]]);
+                std::copy(inner.begin(), inner.end(), V[d]);
+            }
+            matrixMultiplyRectangular(V, product.B, W, k, n, n, threads);
+            for (int d = 0; d < k; d++) std::copy(W[d], W[d] + n, image(denseInner[d]));
+            freeMatrix(V);
+            freeMatrix(W);
+        } else {
+            long long** U = allocateMatrix(n, k);
+            long long** X = allocateMatrix(n, k);
+            for (int r = 0; r < n; r++) {
+                for (int d = 0; d < k; d++) U[r][d] = innerVector(updates[denseInner[d]])[r];
+            }
+            matrixMultiplyRectangular(product.A, U, X, n, n, k, threads);
+            for (int r = 0; r < n; r++) {
+                for (int d = 0; d < k; d++) image(denseInner[d])[r] = X[r][d];
+            }
+            freeMatrix(U);
+            freeMatrix(X);
+        }
+    }
+
+    // Step 2: spread each image along its outer vector
+    std::vector<int> denseOuter;
+    for (int t = 0; t < count; t++) {
+        const int index = outerIndex(updates[t]);
+        if (index < 0) {
+            denseOuter.push_back(t);
+            continue;
+        }
+        const long long* w = image(t);
+        if (changesA) {
+            for (int j = 0; j < n; j++) product.C[index][j] += w[j];
+        } else {
+            for (int r = 0; r < n; r++) product.C[r][index] += w[r];
+        }
+    }
+    if (!denseOuter.empty()) {
+        const int k = static_cast<int>(denseOuter.size());
+        long long** left = allocateMatrix(n, k);
+        long long** right = allocateMatrix(k, n);
+        for (int d = 0; d < k; d++) {
+            const std::vector<long long>& outer = outerVector(updates[denseOuter[d]]);
+            const long long* w = image(denseOuter[d]);
+            for (int r = 0; r < n; r++) {
+                left[r][d] = changesA ? outer[r] : w[r];
+                right[d][r] = changesA ? w[r] : outer[r];
+            }
+        }
+        matrixMultiplyRectangular(left, right, product.C, n, k, n, threads, 1, 1);
+        freeMatrix(left);
+        freeMatrix(right);
+    }
+    product.pending.clear();
+}
+
+/**
+ * Make the queue ready for updates to one operand. Queued updates to the
+ * other operand are flushed first, before either operand changes: a flush
+ * of A changes multiplies by B and must see the B those changes were
+ * made against.
+ */
+void beginUpdate(MaintainedProduct& product, ProductOperand operand) {
+    if (!product.pending.empty() && product.pendingOperand != operand) flushPendingUpdates(product);
+    product.pendingOperand = operand;
+}
+
+void replaceRowA(MaintainedProduct& product, int row, const long long* values) {
+    beginUpdate(product, ProductOperand::A);
+    RankOneUpdate update;
+    update.uIndex = row;
+    update.v.resize(product.n);
+    for (int j = 0; j < product.n; j++) {
+        update.v[j] = values[j] - product.A[row][j];
+        product.A[row][j] = values[j];
+    }
+    product.pending.push_back(std::move(update));
+}
+
+void replaceColumnA(MaintainedProduct& product, int col, const long long* values) {
+    beginUpdate(product, ProductOperand::A);
+    RankOneUpdate update;
+    update.vIndex = col;
+    update.u.resize(product.n);
+    for (int i = 0; i < product.n; i++) {
+        update.u[i] = values[i] - product.A[i][col];
+        product.A[i][col] = values[i];
+    }
+    product.pending.push_back(std::move(update));
+}
+
+void replaceRowB(MaintainedProduct& product, int row, const long long* values) {
+    beginUpdate(product, ProductOperand::B);
+    RankOneUpdate update;
+    update.uIndex = row;
+    update.v.resize(product.n);
+    for (int j = 0; j < product.n; j++) {
+        update.v[j] = values[j] - product.B[row][j];
+        product.B[row][j] = values[j];
+    }
+    product.pending.push_back(std::move(update));
+}
+
+void replaceColumnB(MaintainedProduct& product, int col, const long long* values) {
+    beginUpdate(product, ProductOperand::B);
+    RankOneUpdate update;
+    update.vIndex = col;
+    update.u.resize(product.n);
+    for (int i = 0; i < product.n; i++) {
+        update.u[i] = values[i] - product.B[i][col];
+        product.B[i][col] = values[i];
+    }
+    product.pending.push_back(std::move(update));
+}
+
+/**
+ * Rank-k update of one operand: M += U × V with U n × k and V k × n.
+ * The operand is updated now; the product waits for the next read.
+ */
+void rankUpdate(MaintainedProduct& product, ProductOperand operand, long long** U, long long** V, int k) {
+    const int n = product.n;
+    beginUpdate(product, operand);
+    long long** target = operand == ProductOperand::A ? product.A : product.B;
+    matrixMultiplyRectangular(U, V, target, n, k, n, product.numThreads, 1, 1);
+    for (int t = 0; t < k; t++) {
+        RankOneUpdate update;
+        update.u.resize(n);
+        for (int i = 0; i < n; i++) update.u[i] = U[i][t];
+        update.v.assign(V[t], V[t] + n);
+        product.pending.push_back(std::move(update));
+    }
+}
+
+/**
+ * The current product A × B, after applying any pending updates.
+ */
+long long** maintainedProduct(MaintainedProduct& product) {
+    flushPendingUpdates(product);
+    return product.C;
+}
+
+/**
+ * Error target for approximate multiplication: with probability at least
+ * 1 - delta, ||C - A × B||_F ≤ epsilon × ||A||_F × ||B||_F.
+ */
+struct ApproximateOptions {
+    double epsilon = 0.1;
+    double delta = 0.1;
+    unsigned long long seed = 1;
+};
+
+struct ApproximateStats {
+    long long samples = 0;      // Column/row pairs drawn
+    int distinctSamples = 0;    // Distinct inner indices among them
+    double errorBound = 0.0;    // Frobenius bound that holds with probability ≥ 1 - delta
+    bool exact = false;         // Sampling would not have been cheaper; C is exact
+};
+
+/**
+ * Error bound factor for confidence 1 - δ. The estimator below has
+ * E||C - AB||_F² ≤ (Σ_k |A(:,k)| |B(k,:)|)² / s, so Markov's inequality
+ * gives a factor of 1/√δ. Redrawing one of the s samples moves the error
+ * by at most 2 Σ_k |A(:,k)| |B(k,:)| / s, so McDiarmid's inequality gives
+ * 1 + √(2 ln(1/δ)) instead, which grows only with log(1/δ); the smaller
+ * of the two holds.
+ */
+double approximateConfidenceFactor(double delta) {
+    return std::min(1.0 / std::sqrt(delta), 1.0 + std::sqrt(2.0 * std::log(1.0 / delta)));
+}
+
+/**
+ * Sample count for an error target: s = (ρ η / ε)² with η the confidence
+ * factor above and ρ = Σ_k |A(:,k)| |B(k,:)| / (||A||_F ||B||_F) ≤ 1
+ * measured from the data instead of assumed.
+ */
+long long approximateSampleCount(double rho, const ApproximateOptions& options) {
+    const double factor = rho * approximateConfidenceFactor(options.delta) / options.epsilon;
+    const double samples = std::ceil(factor * factor);
+    return samples >= static_cast<double>(LLONG_MAX) ? LLONG_MAX : std::max(1LL, static_cast<long long>(samples));
+}
+
+/**
+ * Approximate Multiplication by Column/Row Sampling
+ * Time Complexity: O(n² + n² × s / threads), s = (ρ η / ε)² with
+ *                  η = min(1/√δ, 1 + √(2 ln(1/δ)))
+ * Space Complexity: O(n × max(n, s)) for the packed rank-s operands
+ * 
+ * Algorithm Steps:
+ * 1. Compute the column norms of A and the row norms of B
+ * 2. Estimate the distinct indices s draws would hit; if a rank of that
+ *    size costs no less than the planned exact product (its Winograd
+ *    levels and leaf kernel speed counted), or fewer than one index with
+ *    p_k > 0 is expected to go undrawn, compute the exact product instead
+ * 3. Draw s inner indices k i.i.d. with probability
+ *    p_k ∝ |A(:,k)| × |B(k,:)|, the variance-minimizing choice — as the
+ *    multinomial counts c_k directly, each a binomial share of the draws
+ *    left, so the cost is O(n) whatever s is
+ * 4. Index k drawn c_k times gets weight c_k / (s × p_k), which makes
+ *    the estimator unbiased
+ * 5. C = Σ_k weight_k × A(:,k) × B(k,:), a rank-s product run through the
+ *    exact-double micro-kernels and rounded to the nearest integer
+ * 
+ * The counts come from one std::mt19937_64 seeded with options.seed, in
+ * index order, so a seed reproduces the same C on any thread count.
+ * 
+ * Memory Optimization:
+ * - Only the sampled columns of A and rows of B are packed, with the
+ *   weights folded into the columns of A
+ */
+void matrixMultiplyApproximate(long long** A, long long** B, long long** C, int n, const ApproximateOptions& options,
+                               ApproximateStats* stats = nullptr, int numThreads = 0) {
+    ApproximateStats result;
+    std::vector<double> columnNormA(n, 0.0), rowNormB(n, 0.0);
+    for (int i = 0; i < n; i++) {
+        for (int k = 0; k < n; k++) {
+            const double a = static_cast<double>(A[i][k]);
+            const double b = static_cast<double>(B[i][k]);
+            columnNormA[k] += a * a;
+            rowNormB[i] += b * b;
+        }
+    }
+    std::vector<double> mass(n);
+    double normA2 = 0.0, normB2 = 0.0, total = 0.0;
+    int support = 0;
+    for (int k = 0; k < n; k++) {
+        normA2 += columnNormA[k];
+        normB2 += rowNormB[k];
+        mass[k] = std::sqrt(columnNormA[k] * rowNormB[k]);
+        total += mass[k];
+        if (mass[k] > 0.0) support++;
+    }
+    if (total == 0.0) {  // Every outer product is zero
+        fillMatrixParallel(C, n, n, [](int, int) { return 0LL; }, numThreads);
+        result.exact = true;
+        if (stats) *stats = result;
+        return;
+    }
+
+    const long long samples = approximateSampleCount(total / std::sqrt(normA2 * normB2), options);
+    // Index k is hit with probability 1 - (1 - p_k)^s
+    double expectedDistinct = 0.0;
+    for (int k = 0; k < n; k++) {
+        const double probability = mass[k] / total;
+        expectedDistinct += probability >= 1.0 ? 1.0 : -std::expm1(static_cast<double>(samples) * std::log1p(-probability));
+    }
+    // Sampling stops paying once it costs the exact product, or once it is expected to draw the whole support
+    const MultiplyPlan plan = planMultiply(A, B, n, numThreads);
+    const double exactRank = n * std::pow(7.0 / 8.0, plan.winogradLevels) / leafKernelThroughput(plan.leafKernel);
+    if (expectedDistinct >= std::min(exactRank, support - 1.0)) {
+        executePlan(plan, A, B, C);
+        result.samples = n;
+        result.distinctSamples = n;
+        result.exact = true;
+        if (stats) *stats = result;
+        return;
+    }
+
+    // Multinomial counts as a chain of binomials: index k takes its share of the draws left
+    std::vector<long long> draws(n, 0);
+    std::mt19937_64 generator(options.seed);
+    long long remaining = samples;
+    double remainingMass = total;
+    int lastIndex = n - 1;
+    while (mass[lastIndex] == 0.0) lastIndex--;
+    for (int k = 0; k <= lastIndex && remaining > 0; k++) {
+        if (mass[k] == 0.0) continue;
+        const double share = k == lastIndex ? 1.0 : std::min(1.0, mass[k] / remainingMass);
+        draws[k] = share >= 1.0 ? remaining : std::binomial_distribution<long long>(remaining, share)(generator);
+        remaining -= draws[k];
+        remainingMass -= mass[k];
+    }
+    std::vector<int> picked;
+    std::vector<double> weight;
+    for (int k = 0; k < n; k++) {
+        if (draws[k] == 0) continue;
+        const double probability = mass[k] / total;
+        picked.push_back(k);
+        weight.push_back(static_cast<double>(draws[k]) / (static_cast<double>(samples) * probability));
+    }
+    const int s = static_cast<int>(picked.size());
+
+    // Weighted sampled columns of A, n × s; sampled rows of B, s × n; padded for the micro-kernel
+    const int ld = (std::max(n, s) + EXACT_MICRO_COLS - 1) / EXACT_MICRO_COLS * EXACT_MICRO_COLS;
+    const int paddedRows = (n + EXACT_MICRO_ROWS - 1) / EXACT_MICRO_ROWS * EXACT_MICRO_ROWS;
+    std::vector<double> sampledA(static_cast<size_t>(paddedRows) * ld, 0.0), sampledB(static_cast<size_t>(s) * ld, 0.0);
+    std::vector<double> product(static_cast<size_t>(paddedRows) * ld, 0.0);
+    parallelFor(0, n, [&](int rowBegin, int rowEnd) {
+        for (int i = rowBegin; i < rowEnd; i++) {
+            for (int t = 0; t < s; t++) sampledA[static_cast<size_t>(i) * ld + t] = weight[t] * static_cast<double>(A[i][picked[t]]);
+        }
+    }, numThreads);
+    for (int t = 0; t < s; t++) {
+        std::copy(B[picked[t]], B[picked[t]] + n, sampledB.begin() + static_cast<size_t>(t) * ld);
+    }
+    exactMicroKernelSweep(sampledA.data(), sampledB.data(), product.data(), ld, paddedRows, ld, s, EXACT_BLOCK_DEPTH, numThreads);
+    fillMatrixParallel(C, n, n, [&](int i, int j) { return std::llround(product[static_cast<size_t>(i) * ld + j]); }, numThreads);
+
+    result.samples = samples;
+    result.distinctSamples = s;
+    result.errorBound = total * approximateConfidenceFactor(options.delta) / std::sqrt(static_cast<double>(samples));
+    if (stats) *stats = result;
+}
+
+/**
+ * Field Definitions
+ * The solvers below are templates over a field, the way the blocked
+ * engine is a template over a semiring. On top of the ring operations a
+ * field supplies inverse, pivotWeight (larger is a better pivot, zero
+ * means unusable) and multiplyLeaf, the dense C = A × B kernel that the
+ * Strassen-Winograd recursion bottoms out in.
+ *
+ * Unlike the semirings, PrimeField carries its modulus at runtime, so
+ * fields are passed as objects.
+ */
+struct RealField {
+    using Element = double;
+
+    double zero() const { return 0.0; }
+    double one() const { return 1.0; }
+    double add(double a, double b) const { return a + b; }
+    double subtract(double a, double b) const { return a - b; }
+    double multiply(double a, double b) const { return a * b; }
+    double inverse(double a) const { return 1.0 / a; }
+    double pivotWeight(double a) const { return std::fabs(a); }
+
+    /**
+     * Packs the operands into padded buffers and runs the FMA (or SSE2)
+     * micro-kernel of the exact-double engine.
+     */
+    void multiplyLeaf(double** A, double** B, double** C, int m, int k, int n, int numThreads) const {
+        const int ld = (std::max(k, n) + EXACT_MICRO_COLS - 1) / EXACT_MICRO_COLS * EXACT_MICRO_COLS;
+        const int paddedRows = (m + EXACT_MICRO_ROWS - 1) / EXACT_MICRO_ROWS * EXACT_MICRO_ROWS;
+        const int paddedCols = (n + EXACT_MICRO_COLS - 1) / EXACT_MICRO_COLS * EXACT_MICRO_COLS;
+        std::vector<double> a(static_cast<size_t>(paddedRows) * ld, 0.0);
+        std::vector<double> b(static_cast<size_t>(std::max(k, 1)) * ld, 0.0);
+        std::vector<double> c(static_cast<size_t>(paddedRows) * ld, 0.0);
+        for (int i = 0; i < m; i++) std::copy(A[i], A[i] + k, a.begin() + static_cast<size_t>(i) * ld);
+        for (int r = 0; r < k; r++) std::copy(B[r], B[r] + n, b.begin() + static_cast<size_t>(r) * ld);
+        exactMicroKernelSweep(a.data(), b.data(), c.data(), ld, paddedRows, paddedCols, k, EXACT_BLOCK_DEPTH, numThreads);
+        for (int i = 0; i < m; i++) std::copy(c.begin() + static_cast<size_t>(i) * ld, c.begin() + static_cast<size_t>(i) * ld + n, C[i]);
+    }
+};
+
+/**
+ * Integers modulo a prime below 2^31, stored as long long in [0, p).
+ * Products of two residues fit in an unsigned 64-bit word, so the leaf
+ * kernel adds several of them before reducing.
+ */
+struct PrimeField {
+    using Element = long long;
+    long long modulus;
+
+    explicit PrimeField(long long p) : modulus(p) {}
+
+    long long zero() const { return 0; }
+    long long one() const { return 1; }
+    long long add(long long a, long long b) const {
+        const long long sum = a + b;
+        return sum >= modulus ? sum - modulus : sum;
+    }
+    long long subtract(long long a, long long b) const {
+        const long long difference = a - b;
+        return difference < 0 ? difference + modulus : difference;
+    }
+    long long multiply(long long a, long long b) const {
+        return static_cast<long long>(static_cast<unsigned long long>(a) * static_cast<unsigned long long>(b) %
+                                      static_cast<unsigned long long>(modulus));
+    }
+    long long power(long long base, long long exponent) const {
+        long long result = 1;
+        for (; exponent > 0; exponent >>= 1) {
+            if (exponent & 1) result = multiply(result, base);
+            base = multiply(base, base);
+        }
+        return result;
+    }
+    long long inverse(long long a) const { return power(a, modulus - 2); }  // Fermat
+    double pivotWeight(long long a) const { return a != 0 ? 1.0 : 0.0; }
+    long long reduce(long long value) const {
+        const long long r = value % modulus;
+        return r < 0 ? r + modulus : r;
+    }
+
+    /**
+     * Row-times-row accumulation in unsigned 64-bit lanes, reduced every
+     * `interval` steps of k: interval × (p - 1)² + p stays below 2^64.
+     */
+    void multiplyLeaf(long long** A, long long** B, long long** C, int m, int k, int n, int numThreads) const {
+        const unsigned long long p = static_cast<unsigned long long>(modulus);
+        const unsigned long long largestProduct = (p - 1) * (p - 1);
+        const int interval = static_cast<int>(std::min<unsigned long long>(
+            largestProduct == 0 ? k + 1ULL : (~0ULL - p) / largestProduct, static_cast<unsigned long long>(k) + 1));
+        parallelFor(0, m, [&](int rowBegin, int rowEnd) {
+            std::vector<unsigned long long> acc(SEMIRING_BLOCK_COLS);
+            for (int j0 = 0; j0 < n; j0 += SEMIRING_BLOCK_COLS) {
+                const int width = std::min(SEMIRING_BLOCK_COLS, n - j0);
+                for (int i = rowBegin; i < rowEnd; i++) {
+                    std::fill(acc.begin(), acc.begin() + width, 0ULL);
+                    int steps = 0;
+                    for (int kk = 0; kk < k; kk++) {
+                        const unsigned long long a = static_cast<unsigned long long>(A[i][kk]);
+                        if (a == 0) continue;
+                        const long long* bRow = B[kk] + j0;
+                        for (int j = 0; j < width; j++) acc[j] += a * static_cast<unsigned long long>(bRow[j]);
+                        if (++steps == interval) {
+                            for (int j = 0; j < width; j++) acc[j] %= p;
+                            steps = 1;  // The reduced values count as one product
+                        }
+                    }
+                    for (int j = 0; j < width; j++) C[i][j0 + j] = static_cast<long long>(acc[j] % p);
+                }
+            }
+        }, numThreads);
+    }
+};
+
+const int FIELD_STRASSEN_CUTOFF = 128;
+
+/**
+ * Strassen-Winograd Multiplication over a Field
+ * Time Complexity: O(n^2.807) for square operands
+ * Space Complexity: O(m × k + k × n + m × n) temporaries
+ *
+ * Computes C = A × B for an m × k by k × n product.
+ *
+ * Algorithm Steps:
+ * 1. Any dimension at or below FIELD_STRASSEN_CUTOFF: field.multiplyLeaf
+ * 2. An odd dimension is peeled: the last row of A or column of B gets a
+ *    thin leaf product, an odd k a rank-1 update, and the even part recurses
+ * 3. Otherwise one Winograd level through beginWinogradLevel and
+ *    finishWinogradLevel with the field as the arithmetic, so the sums and
+ *    the combine run on numThreads threads as in the integer engines
+ */
+template <typename Field>
+void fieldMultiply(const Field& field, typename Field::Element** A, typename Field::Element** B,
+                   typename Field::Element** C, int m, int k, int n, int numThreads = 0) {
+    using T = typename Field::Element;
+    if (m <= FIELD_STRASSEN_CUTOFF || k <= FIELD_STRASSEN_CUTOFF || n <= FIELD_STRASSEN_CUTOFF) {
+        field.multiplyLeaf(A, B, C, m, k, n, numThreads);
+        return;
+    }
+    if (m % 2 != 0) {
+        fieldMultiply(field, A, B, C, m - 1, k, n, numThreads);
+        field.multiplyLeaf(A + m - 1, B, C + m - 1, 1, k, n, numThreads);
+        return;
+    }
+    if (n % 2 != 0) {
+        fieldMultiply(field, A, B, C, m, k, n - 1, numThreads);
+        std::vector<T*> lastColumnB(k), lastColumnC(m);
+        for (int r = 0; r < k; r++) lastColumnB[r] = B[r] + n - 1;
+        for (int i = 0; i < m; i++) lastColumnC[i] = C[i] + n - 1;
+        field.multiplyLeaf(A, lastColumnB.data(), lastColumnC.data(), m, k, 1, numThreads);
+        return;
+    }
+    if (k % 2 != 0) {
+        fieldMultiply(field, A, B, C, m, k - 1, n, numThreads);
+        for (int i = 0; i < m; i++) {
+            const T a = A[i][k - 1];
+            for (int j = 0; j < n; j++) C[i][j] = field.add(C[i][j], field.multiply(a, B[k - 1][j]));
+        }
+        return;
+    }
+
+    WinogradLevelOf<Field> level;
+    beginWinogradLevel(level, field, A, B, C, m, k, n, numThreads);
+    for (int p = 0; p < 7; p++) {
+        fieldMultiply(field, level.lhs[p], level.rhs[p], level.M[p], level.rows, level.depth, level.cols, numThreads);
+    }
+    finishWinogradLevel(level, field, numThreads, [](T& destination, T value) { destination = value; });
+}
+
+/**
+ * C -= A × B for an m × k by k × n product, through fieldMultiply.
+ */
+template <typename Field>
+void fieldMultiplySubtract(const Field& field, typename Field::Element** A, typename Field::Element** B,
+                           typename Field::Element** C, int m, int k, int n, int numThreads) {
+    using T = typename Field::Element;
+    if (m == 0 || k == 0 || n == 0) return;
+    T** product = allocateElementMatrix<T>(m, n);
+    fieldMultiply(field, A, B, product, m, k, n, numThreads);
+    for (int i = 0; i < m; i++) {
+        for (int j = 0; j < n; j++) C[i][j] = field.subtract(C[i][j], product[i][j]);
+    }
+    freeElementMatrix(product);
+}
+
+/**
+ * Triangular Solves (in place, n × r right-hand side X)
+ * Lower: L X = B with L unit lower triangular. Upper: U X = B with U
+ * upper triangular. Both split L (or U) in halves, solve one half,
+ * update the other half of B with one fieldMultiplySubtract and recurse,
+ * so all but O(n² × r / cutoff) of the work is matrix multiplication.
+ */
+template <typename Field>
+void solveLowerUnit(const Field& field, typename Field::Element** L, typename Field::Element** X, int n, int r,
+                    int numThreads) {
+    using T = typename Field::Element;
+    if (n <= FIELD_STRASSEN_CUTOFF) {
+        for (int i = 0; i < n; i++) {
+            for (int k = 0; k < i; k++) {
+                const T l = L[i][k];
+                for (int j = 0; j < r; j++) X[i][j] = field.subtract(X[i][j], field.multiply(l, X[k][j]));
+            }
+        }
+        return;
+    }
+    const int n1 = n / 2;
+    std::vector<T*> lower21(n - n1), lower22(n - n1);
+    for (int i = 0; i < n - n1; i++) {
+        lower21[i] = L[n1 + i];
+        lower22[i] = L[n1 + i] + n1;
+    }
+    solveLowerUnit(field, L, X, n1, r, numThreads);
+    fieldMultiplySubtract(field, lower21.data(), X, X + n1, n - n1, n1, r, numThreads);
+    solveLowerUnit(field, lower22.data(), X + n1, n - n1, r, numThreads);
+}
+
+template <typename Field>
+void solveUpper(const Field& field, typename Field::Element** U, typename Field::Element** X, int n, int r,
+                int numThreads) {
+    using T = typename Field::Element;
+    if (n <= FIELD_STRASSEN_CUTOFF) {
+        for (int i = n - 1; i >= 0; i--) {
+            for (int k = i + 1; k < n; k++) {
+                const T u = U[i][k];
+                for (int j = 0; j < r; j++) X[i][j] = field.subtract(X[i][j], field.multiply(u, X[k][j]));
+            }
+            const T pivotInverse = field.inverse(U[i][i]);
+            for (int j = 0; j < r; j++) X[i][j] = field.multiply(X[i][j], pivotInverse);
+        }
+        return;
+    }
+    const int n1 = n / 2;
+    std::vector<T*> upper12(n1), upper22(n - n1);
+    for (int i = 0; i < n1; i++) upper12[i] = U[i] + n1;
+    for (int i = 0; i < n - n1; i++) upper22[i] = U[n1 + i] + n1;
+    solveUpper(field, upper22.data(), X + n1, n - n1, r, numThreads);
+    fieldMultiplySubtract(field, upper12.data(), X + n1, X, n1, n - n1, r, numThreads);
+    solveUpper(field, U, X, n1, r, numThreads);
+}
+
+/**
+ * Swap rows i and pivots[i] of an m × cols block, for i in [0, count).
+ */
+template <typename T>
+void applyRowSwaps(T** M, int cols, const int* pivots, int count) {
+    for (int i = 0; i < count; i++) {
+        if (pivots[i] != i) std::swap_ranges(M[i], M[i] + cols, M[pivots[i]]);
+    }
+}
+
+/**
+ * Recursive LU of an m × n panel (m ≥ n), in place, with partial
+ * pivoting; pivots[j] is the panel row swapped into row j.
+ *
+ * Algorithm Steps:
+ * 1. One column: pick the row with the largest pivotWeight, swap it up
+ *    and scale the column below by the pivot's inverse
+ * 2. Otherwise factor the left half of the columns recursively and apply
+ *    its row swaps to the right half
+ * 3. A12 = L11⁻¹ A12 with solveLowerUnit, then A22 -= A21 × A12 with
+ *    fieldMultiplySubtract — the step that carries the fast multiply
+ * 4. Factor A22 recursively and apply its swaps to the left half
+ *
+ * Returns false on a zero pivot column (a singular matrix).
+ */
+template <typename Field>
+bool luPanel(const Field& field, typename Field::Element** A, int m, int n, int* pivots, int numThreads) {
+    using T = typename Field::Element;
+    if (n == 1) {
+        int best = 0;
+        for (int i = 1; i < m; i++) {
+            if (field.pivotWeight(A[i][0]) > field.pivotWeight(A[best][0])) best = i;
+        }
+        pivots[0] = best;
+        if (field.pivotWeight(A[best][0]) == 0.0) return false;
+        std::swap(A[0][0], A[best][0]);
+        const T pivotInverse = field.inverse(A[0][0]);
+        for (int i = 1; i < m; i++) A[i][0] = field.multiply(A[i][0], pivotInverse);
+        return true;
+    }
+    const int n1 = n / 2;
+    const int n2 = n - n1;
+    std::vector<T*> right(m);
+    for (int i = 0; i < m; i++) right[i] = A[i] + n1;
+    if (!luPanel(field, A, m, n1, pivots, numThreads)) return false;
+    applyRowSwaps(right.data(), n2, pivots, n1);
+
+    solveLowerUnit(field, A, right.data(), n1, n2, numThreads);
+    fieldMultiplySubtract(field, A + n1, right.data(), right.data() + n1, m - n1, n1, n2, numThreads);
+
+    if (!luPanel(field, right.data() + n1, m - n1, n2, pivots + n1, numThreads)) return false;
+    applyRowSwaps(A + n1, n1, pivots + n1, n2);
+    for (int j = n1; j < n; j++) pivots[j] += n1;
+    return true;
+}
+
+/**
+ * Recursive LU Decomposition
+ * Time Complexity: O(n^2.807) — every level's work is triangular solves
+ *                  and products of fieldMultiply
+ * Space Complexity: O(n²) temporaries
+ *
+ * Factors A in place into P A = L U: L (unit diagonal, not stored) below
+ * the diagonal, U on and above it. pivots receives n row indices in the
+ * LAPACK convention. Returns false if A is singular.
+ */
+template <typename Field>
+bool luDecompose(const Field& field, typename Field::Element** A, int n, std::vector<int>& pivots, int numThreads = 0) {
+    pivots.assign(n, 0);
+    return n == 0 || luPanel(field, A, n, n, pivots.data(), numThreads);
+}
+
+/**
+ * Solve A X = B from a factorization by luDecompose: apply the row swaps
+ * to B, then one lower and one upper triangular solve. X may alias B.
+ */
+template <typename Field>
+void luSolve(const Field& field, typename Field::Element** lu, const std::vector<int>& pivots,
+             typename Field::Element** B, typename Field::Element** X, int n, int r, int numThreads = 0) {
+    if (X != B) {
+        for (int i = 0; i < n; i++) std::copy(B[i], B[i] + r, X[i]);
+    }
+    applyRowSwaps(X, r, pivots.data(), n);
+    solveLowerUnit(field, lu, X, n, r, numThreads);
+    solveUpper(field, lu, X, n, r, numThreads);
+}
+
+/**
+ * Linear Solve
+ * Time Complexity: O(n^2.807 + n² × r)
+ * Space Complexity: O(n²)
+ *
+ * X = A⁻¹ B for an n × r right-hand side, through a copy of A factored
+ * by luDecompose. Returns false if A is singular.
+ */
+template <typename Field>
+bool matrixSolve(const Field& field, typename Field::Element** A, typename Field::Element** B,
+                 typename Field::Element** X, int n, int r, int numThreads = 0) {
+    using T = typename Field::Element;
+    T** lu = allocateElementMatrix<T>(n, n);
+    for (int i = 0; i < n; i++) std::copy(A[i], A[i] + n, lu[i]);
+    std::vector<int> pivots;
+    const bool regular = luDecompose(field, lu, n, pivots, numThreads);
+    if (regular) luSolve(field, lu, pivots, B, X, n, r, numThreads);
+    freeElementMatrix(lu);
+    return regular;
+}
+
+/**
+ * Divide-and-Conquer Matrix Inversion
+ * Time Complexity: O(n^2.807)
+ * Space Complexity: O(n²)
+ *
+ * A⁻¹ solves A X = I: one recursive LU and two triangular solves with n
+ * right-hand sides, all reduced to fieldMultiply. Block inversion by the
+ * Schur complement has the same bound, but needs every leading block to
+ * be invertible; the pivoted LU does not. Returns false if A is singular.
+ */
+template <typename Field>
+bool matrixInverse(const Field& field, typename Field::Element** A, typename Field::Element** inverse, int n,
+                   int numThreads = 0) {
+    for (int i = 0; i < n; i++) {
+        std::fill(inverse[i], inverse[i] + n, field.zero());
+        inverse[i][i] = field.one();
+    }
+    return matrixSolve(field, A, inverse, inverse, n, n, numThreads);
+}
+
+/**
+ * Gauss-Jordan Inversion
+ * Time Complexity: O(n³)
+ * Space Complexity: O(n²)
+ *
+ * Eliminates [A | I] to [I | A⁻¹] column by column with partial
+ * pivoting. Kept as the baseline for matrixInverse. Returns false if A
+ * is singular.
+ */
+template <typename Field>
+bool invertGaussJordan(const Field& field, typename Field::Element** A, typename Field::Element** inverse, int n) {
+    using T = typename Field::Element;
+    T** work = allocateElementMatrix<T>(n, n);
+    for (int i = 0; i < n; i++) {
+        std::copy(A[i], A[i] + n, work[i]);
+        std::fill(inverse[i], inverse[i] + n, field.zero());
+        inverse[i][i] = field.one();
+    }
+    bool regular = true;
+    for (int col = 0; col < n && regular; col++) {
+        int best = col;
+        for (int i = col + 1; i < n; i++) {
+            if (field.pivotWeight(work[i][col]) > field.pivotWeight(work[best][col])) best = i;
+        }
+        if (field.pivotWeight(work[best][col]) == 0.0) {
+            regular = false;
+            break;
+        }
+        if (best != col) {
+            std::swap_ranges(work[col], work[col] + n, work[best]);
+            std::swap_ranges(inverse[col], inverse[col] + n, inverse[best]);
+        }
+        const T pivotInverse = field.inverse(work[col][col]);
+        for (int j = 0; j < n; j++) {
+            work[col][j] = field.multiply(work[col][j], pivotInverse);
+            inverse[col][j] = field.multiply(inverse[col][j], pivotInverse);
+        }
+        for (int i = 0; i < n; i++) {
+            if (i == col) continue;
+            const T factor = work[i][col];
+            for (int j = 0; j < n; j++) {
+                work[i][j] = field.subtract(work[i][j], field.multiply(factor, work[col][j]));
+                inverse[i][j] = field.subtract(inverse[i][j], field.multiply(factor, inverse[col][j]));
+            }
+        }
+    }
+    freeElementMatrix(work);
+    return regular;
+}
+
+/**
+ * Bareiss Fraction-Free Determinant
+ * Time Complexity: O(n³) 128-bit operations
+ * Space Complexity: O(n²)
+ *
+ * Algorithm Steps:
+ * 1. Copy A; at step k swap a row with a nonzero pivot into place,
+ *    flipping the sign (a zero column means det = 0)
+ * 2. Update the trailing block by
+ *    M[i][j] = (M[i][j] × M[k][k] - M[i][k] × M[k][j]) / previous pivot,
+ *    a division that is always exact: every entry after step k is a
+ *    (k+1) × (k+1) minor of A
+ * 3. The last pivot is the determinant
+ *
+ * Products and their difference are formed in __int128 with overflow
+ * checks, so any long long entries are safe, and every quotient is
+ * checked to fit in long long. Returns false if one does not (the
+ * determinant or an intermediate minor needs more than 64 bits; use
+ * matrixDeterminant).
+ */
+bool determinantBareiss(long long** A, int n, long long& determinant) {
+    if (n == 0) {
+        determinant = 1;
+        return true;
+    }
+    long long** M = allocateMatrix(n);
+    for (int i = 0; i < n; i++) std::copy(A[i], A[i] + n, M[i]);
+    __int128 previous = 1;
+    bool negate = false;
+    bool fits = true;
+    determinant = 0;
+    for (int k = 0; k < n - 1 && fits; k++) {
+        int pivot = k;
+        while (pivot < n && M[pivot][k] == 0) pivot++;
+        if (pivot == n) {
+            freeMatrix(M);
+            return true;  // Singular: determinant stays 0
+        }
+        if (pivot != k) {
+            std::swap_ranges(M[k] + k, M[k] + n, M[pivot] + k);
+            negate = !negate;
+        }
+        const __int128 diagonal = M[k][k];
+        for (int i = k + 1; i < n && fits; i++) {
+            const __int128 left = M[i][k];
+            for (int j = k + 1; j < n; j++) {
+                __int128 scaled, eliminated, difference;
+                if (__builtin_mul_overflow(static_cast<__int128>(M[i][j]), diagonal, &scaled) ||
+                    __builtin_mul_overflow(left, static_cast<__int128>(M[k][j]), &eliminated) ||
+                    __builtin_sub_overflow(scaled, eliminated, &difference)) {
+                    fits = false;
+                    break;
+                }
+                const __int128 value = difference / previous;
+                if (value > LLONG_MAX || value < LLONG_MIN) {
+                    fits = false;
+                    break;
+                }
+                M[i][j] = static_cast<long long>(value);
+            }
+        }
+        previous = diagonal;
+    }
+    const long long last = M[n - 1][n - 1];
+    freeMatrix(M);
+    if (!fits || (negate && last == LLONG_MIN)) return false;
+    determinant = negate ? -last : last;
+    return true;
+}
+
+const int ECHELON_PANEL_WIDTH = 64;
+
+/**
+ * Rank and determinant of a matrix modulo a prime.
+ */
+struct ModularEchelon {
+    int rank = 0;
+    long long determinant = 0;  // Zero unless the matrix is square and of full rank
+};
+
+/**
+ * Blocked Modular Row Echelon Form
+ * Time Complexity: O(rows × cols × min(rows, cols)), almost all of it in
+ *                  fieldMultiplySubtract
+ * Space Complexity: O(rows × cols)
+ *
+ * Algorithm Steps:
+ * 1. Reduce A modulo p into a working copy
+ * 2. Take the next ECHELON_PANEL_WIDTH columns as a panel and eliminate
+ *    within it only: each column with a nonzero entry at or below the
+ *    current row gets a pivot (the whole row is swapped up) and its
+ *    multipliers are stored below the pivot; a column without one is
+ *    skipped, which is what makes the form rank revealing
+ * 3. For the r pivots found, solve L11 U12 = A12 for the pivot rows right
+ *    of the panel, then update the rows below with A22 -= L21 × U12 — a
+ *    matrix product modulo p instead of r separate rank-1 sweeps
+ * 4. Repeat from the first column after the panel
+ *
+ * The determinant is the signed product of the pivots.
+ */
+ModularEchelon modularEchelon(const PrimeField& field, long long** A, int rows, int cols, int numThreads = 0) {
+    long long** M = allocateElementMatrix<long long>(rows, cols);
+    for (int i = 0; i < rows; i++) {
+        for (int j = 0; j < cols; j++) M[i][j] = field.reduce(A[i][j]);
+    }
+    ModularEchelon result;
+    long long pivotProduct = 1;
+    bool negate = false;
+    int pivotRow = 0;
+    for (int c0 = 0; c0 < cols && pivotRow < rows; c0 += ECHELON_PANEL_WIDTH) {
+        const int c1 = std::min(cols, c0 + ECHELON_PANEL_WIDTH);
+        const int p0 = pivotRow;
+        std::vector<int> pivotColumns;
+        for (int c = c0; c < c1 && pivotRow < rows; c++) {
+            int pivot = pivotRow;
+            while (pivot < rows && M[pivot][c] == 0) pivot++;
+            if (pivot == rows) continue;
+            if (pivot != pivotRow) {
+                std::swap_ranges(M[pivotRow], M[pivotRow] + cols, M[pivot]);
+                negate = !negate;
+            }
+            const long long pivotInverse = field.inverse(M[pivotRow][c]);
+            pivotProduct = field.multiply(pivotProduct, M[pivotRow][c]);
+            for (int i = pivotRow + 1; i < rows; i++) {
+                if (M[i][c] == 0) continue;
+                const long long multiplier = field.multiply(M[i][c], pivotInverse);
+                M[i][c] = multiplier;
+                for (int j = c + 1; j < c1; j++) M[i][j] = field.subtract(M[i][j], field.multiply(multiplier, M[pivotRow][j]));
+            }
+            pivotColumns.push_back(c);
+            pivotRow++;
+        }
+
+        const int r = static_cast<int>(pivotColumns.size());
+        const int below = rows - pivotRow;
+        const int right = cols - c1;
+        if (r == 0 || right == 0) continue;
+        // Gather the multipliers of the pivot columns, which need not be adjacent
+        long long** lower11 = allocateElementMatrix<long long>(r, r);
+        long long** lower21 = allocateElementMatrix<long long>(std::max(below, 1), r);
+        for (int b = 0; b < r; b++) {
+            for (int a = b + 1; a < r; a++) lower11[a][b] = M[p0 + a][pivotColumns[b]];
+            for (int i = 0; i < below; i++) lower21[i][b] = M[pivotRow + i][pivotColumns[b]];
+        }
+        std::vector<long long*> upper12(r), trailing(below);
+        for (int a = 0; a < r; a++) upper12[a] = M[p0 + a] + c1;
+        for (int i = 0; i < below; i++) trailing[i] = M[pivotRow + i] + c1;
+        solveLowerUnit(field, lower11, upper12.data(), r, right, numThreads);
+        fieldMultiplySubtract(field, lower21, upper12.data(), trailing.data(), below, r, right, numThreads);
+        freeElementMatrix(lower11);
+        freeElementMatrix(lower21);
+    }
+    result.rank = pivotRow;
+    if (rows == cols && result.rank == rows) {
+        result.determinant = negate ? field.subtract(0, pivotProduct) : pivotProduct;
+    }
+    freeElementMatrix(M);
+    return result;
+}
+
+/**
+ * The count largest primes below 2^31, the PrimeField limit, by trial
+ * division (the divisors stop at 46341).
+ */
+std::vector<long long> largePrimes(int count) {
+    std::vector<long long> primes;
+    for (long long candidate = (1LL << 31) - 1; static_cast<int>(primes.size()) < count; candidate -= 2) {
+        bool prime = true;
+        for (long long d = 3; d * d <= candidate && prime; d += 2) prime = candidate % d != 0;
+        if (prime) primes.push_back(candidate);
+    }
+    return primes;
+}
+
+/**
+ * Non-negative integer in base 10^9 limbs, least significant first —
+ * only what reconstructing a determinant needs.
+ */
+struct DecimalMagnitude {
+    std::vector<std::uint32_t> limbs;
+
+    static const std::uint32_t BASE = 1000000000;
+
+    void multiplyAdd(std::uint32_t factor, std::uint32_t addend) {
+        std::uint64_t carry = addend;
+        for (std::uint32_t& limb : limbs) {
+            const std::uint64_t value = static_cast<std::uint64_t>(limb) * factor + carry;
+            limb = static_cast<std::uint32_t>(value % BASE);
+            carry = value / BASE;
+        }
+        for (; carry > 0; carry /= BASE) limbs.push_back(static_cast<std::uint32_t>(carry % BASE));
+    }
+
+    int compare(const DecimalMagnitude& other) const {
+        if (limbs.size() != other.limbs.size()) return limbs.size() < other.limbs.size() ? -1 : 1;
+        for (size_t i = limbs.size(); i-- > 0;) {
+            if (limbs[i] != other.limbs[i]) return limbs[i] < other.limbs[i] ? -1 : 1;
+        }
+        return 0;
+    }
+
+    // this - other, for this ≥ other
+    DecimalMagnitude minus(const DecimalMagnitude& other) const {
+        DecimalMagnitude result = *this;
+        std::int64_t borrow = 0;
+        for (size_t i = 0; i < result.limbs.size(); i++) {
+            std::int64_t value = static_cast<std::int64_t>(result.limbs[i]) - borrow - (i < other.limbs.size() ? other.limbs[i] : 0);
+            borrow = value < 0 ? 1 : 0;
+            result.limbs[i] = static_cast<std::uint32_t>(value + borrow * BASE);
+        }
+        while (!result.limbs.empty() && result.limbs.back() == 0) result.limbs.pop_back();
+        return result;
+    }
+
+    std::string toString() const {
+        if (limbs.empty()) return "0";
+        std::string text = std::to_string(limbs.back());
+        for (size_t i = limbs.size() - 1; i-- > 0;) {
+            const std::string digits = std::to_string(limbs[i]);
+            text += std::string(9 - digits.size(), '0') + digits;
+        }
+        return text;
+    }
+};
+
+/**
+ * Garner's Reconstruction
+ * Time Complexity: O(k²) for k residues
+ *
+ * Mixed-radix digits d_i of the x in [0, P) with x ≡ residues[i] mod
+ * primes[i], evaluated by Horner's rule; values above P / 2 are taken
+ * as x - P, so the result is the signed integer of least magnitude.
+ */
+std::string garnerReconstruct(const std::vector<long long>& residues, const std::vector<long long>& primes) {
+    const size_t k = primes.size();
+    std::vector<long long> digits(k);
+    for (size_t i = 0; i < k; i++) {
+        const PrimeField field(primes[i]);
+        long long value = residues[i];
+        for (size_t j = 0; j < i; j++) {
+            value = field.multiply(field.subtract(value, field.reduce(digits[j])), field.inverse(field.reduce(primes[j])));
+        }
+        digits[i] = value;
+    }
+    DecimalMagnitude x, product;
+    product.limbs = {1};
+    for (size_t i = k; i-- > 0;) x.multiplyAdd(static_cast<std::uint32_t>(primes[i]), static_cast<std::uint32_t>(digits[i]));
+    for (long long p : primes) product.multiplyAdd(static_cast<std::uint32_t>(p), 0);
+    DecimalMagnitude twice = x;
+    twice.multiplyAdd(2, 0);
+    if (twice.compare(product) > 0) return "-" + product.minus(x).toString();
+    return x.toString();
+}
+
+/**
+ * log2 of Hadamard's bound Π_i ||A(i,:)||₂ ≥ |det A| (-infinity for a
+ * zero row).
+ */
+double hadamardBoundBits(long long** A, int n) {
+    double bits = 0.0;
+    for (int i = 0; i < n; i++) {
+        double rowNorm2 = 0.0;
+        for (int j = 0; j < n; j++) rowNorm2 += static_cast<double>(A[i][j]) * static_cast<double>(A[i][j]);
+        if (rowNorm2 == 0.0) return -INFINITY;
+        bits += 0.5 * std::log2(rowNorm2);
+    }
+    return bits;
+}
+
+/**
+ * Exact Integer Determinant
+ * Time Complexity: O(n³) for Bareiss; O(k × n³) for k primes otherwise,
+ *                  k ≈ (Hadamard bits + 2) / 31
+ * Space Complexity: O(n²) per concurrent prime
+ *
+ * Algorithm Steps:
+ * 1. When Hadamard's bound is below 2^62, every Bareiss intermediate is
+ *    a minor under the same bound, so determinantBareiss cannot overflow
+ * 2. Otherwise take enough primes below 2^31 for their product to exceed
+ *    twice the bound, compute det A mod p with modularEchelon for each —
+ *    independent, so primes run in parallel, one thread each — and
+ *    rebuild the signed determinant with garnerReconstruct
+ *
+ * Returns the determinant in decimal; it may have thousands of digits.
+ */
+std::string matrixDeterminant(long long** A, int n, int numThreads = 0) {
+    const double bits = hadamardBoundBits(A, n);
+    if (bits == -INFINITY) return "0";
+    long long determinant = 0;
+    if (bits < 62.0 && determinantBareiss(A, n, determinant)) return std::to_string(determinant);
+
+    std::vector<long long> primes;
+    const std::vector<long long> candidates = largePrimes(static_cast<int>(std::ceil((bits + 2.0) / 30.0)) + 1);
+    double covered = 0.0;
+    for (long long p : candidates) {
+        if (covered > bits + 1.0) break;
+        primes.push_back(p);
+        covered += std::log2(static_cast<double>(p));
+    }
+    std::vector<long long> residues(primes.size());
+    parallelFor(0, static_cast<int>(primes.size()), [&](int begin, int end) {
+        for (int t = begin; t < end; t++) residues[t] = modularEchelon(PrimeField(primes[t]), A, n, n, 1).determinant;
+    }, numThreads);
+    return garnerReconstruct(residues, primes);
+}
+
+/**
+ * log2 of a bound on every size × size minor of A: such a minor takes
+ * size rows of A, each no longer than the full row, so Hadamard's bound
+ * makes it at most the product of the size largest row norms — and the
+ * same holds for columns. The smaller of the two is returned
+ * (-infinity if fewer than size rows or columns are nonzero).
+ */
+double minorBoundBits(long long** A, int rows, int cols, int size) {
+    std::vector<double> rowBits(rows, 0.0), columnBits(cols, 0.0);
+    for (int i = 0; i < rows; i++) {
+        for (int j = 0; j < cols; j++) {
+            const double value = static_cast<double>(A[i][j]) * static_cast<double>(A[i][j]);
+            rowBits[i] += value;
+            columnBits[j] += value;
+        }
+    }
+    auto largestBits = [size](std::vector<double>& norms2) -> double {
+        if (size > static_cast<int>(norms2.size())) return -INFINITY;
+        std::partial_sort(norms2.begin(), norms2.begin() + size, norms2.end(), std::greater<double>());
+        double bits = 0.0;
+        for (int t = 0; t < size; t++) bits += 0.5 * std::log2(norms2[t]);
+        return bits;
+    };
+    return std::min(largestBits(rowBits), largestBits(columnBits));
+}
+
+/**
+ * Integer Matrix Rank
+ * Time Complexity: O(k × rows × cols × min(rows, cols)) for k primes,
+ *                  k = 1 at full rank, else ≈ (minor bound bits) / 31
+ * Space Complexity: O(rows × cols) per concurrent prime
+ *
+ * Algorithm Steps:
+ * 1. r = rank modulo the largest prime below 2^31; at full rank r is exact
+ * 2. Otherwise every prime used so far divides all (r + 1) × (r + 1)
+ *    minors. Add primes until their product exceeds minorBoundBits for
+ *    size r + 1 and take the rank modulo each new one — independent, so
+ *    they run in parallel, one thread each
+ * 3. If one of them finds a larger rank, raise r and repeat; if none
+ *    does, a nonzero (r + 1) minor would be a multiple of the product of
+ *    the primes and so exceed its own bound — all are zero, and r is
+ *    the rank over the rationals
+ *
+ * The result is exact, not probabilistic. Low-rank matrices only pay for
+ * the minors of size r + 1, not for the full Hadamard bound.
+ */
+int matrixRank(long long** A, int rows, int cols, int numThreads = 0) {
+    std::vector<long long> primes = largePrimes(1);
+    int rank = modularEchelon(PrimeField(primes[0]), A, rows, cols, numThreads).rank;
+    double covered = std::log2(static_cast<double>(primes[0]));
+    while (rank < std::min(rows, cols)) {
+        const double bits = minorBoundBits(A, rows, cols, rank + 1);
+        if (covered > bits) break;
+        const size_t first = primes.size();
+        primes = largePrimes(static_cast<int>(first + std::ceil((bits - covered) / 30.0)) + 1);
+        std::vector<int> ranks(primes.size() - first, 0);
+        parallelFor(0, static_cast<int>(ranks.size()), [&](int begin, int end) {
+            for (int t = begin; t < end; t++) ranks[t] = modularEchelon(PrimeField(primes[first + t]), A, rows, cols, 1).rank;
+        }, numThreads);
+        for (size_t t = first; t < primes.size(); t++) covered += std::log2(static_cast<double>(primes[t]));
+        rank = std::max(rank, *std::max_element(ranks.begin(), ranks.end()));
+    }
+    return rank;
+}
+
+/**
+ * Min-Plus Squaring with Predecessors
+ * Time Complexity: O(n³ / threads)
+ * Space Complexity: O(1)
+ * 
+ * Algorithm Steps:
+ * 1. Start from Dout = D and Pout = P (the k = i and k = j terms)
+ * 2. For every (i, k, j), if D[i][k] + D[k][j] < Dout[i][j], take it and
+ *    set Pout[i][j] = P[k][j] — the last hop into j is the one on k → j
+ * 3. Rows are split between threads in blocks and swept in k and column
+ *    tiles, as in matrixMultiplySemiring
+ * 
+ * Returns true if any entry improved.
+ */
+bool minPlusSquareWithPredecessors(long long** D, long long** P, long long** Dout, long long** Pout, int n, int numThreads = 0) {
+    const int rowBlocks = (n + SEMIRING_BLOCK_ROWS - 1) / SEMIRING_BLOCK_ROWS;
+    std::atomic<bool> changed(false);
+    parallelFor(0, rowBlocks, [&](int blockBegin, int blockEnd) {
+        bool localChanged = false;
+        for (int block = blockBegin; block < blockEnd; block++) {
+            const int i0 = block * SEMIRING_BLOCK_ROWS;
+            const int i1 = std::min(n, i0 + SEMIRING_BLOCK_ROWS);
+            for (int i = i0; i < i1; i++) {
+                std::memcpy(Dout[i], D[i], static_cast<size_t>(n) * sizeof(long long));
+                std::memcpy(Pout[i], P[i], static_cast<size_t>(n) * sizeof(long long));
+            }
+            for (int k0 = 0; k0 < n; k0 += SEMIRING_BLOCK_DEPTH) {
+                const int k1 = std::min(n, k0 + SEMIRING_BLOCK_DEPTH);
+                for (int j0 = 0; j0 < n; j0 += SEMIRING_BLOCK_COLS) {
+                    const int j1 = std::min(n, j0 + SEMIRING_BLOCK_COLS);
+                    for (int i = i0; i < i1; i++) {
+                        long long* dRow = Dout[i];
+                        long long* pRow = Pout[i];
+                        for (int k = k0; k < k1; k++) {
+                            const long long dik = D[i][k];
+                            if (dik >= SEMIRING_INFINITY) continue;
+                            const long long* dkRow = D[k];
+                            const long long* pkRow = P[k];
+                            for (int j = j0; j < j1; j++) {
+                                // Saturating, so an unreachable j stays INF across a negative edge
+                                const long long candidate = MinPlusSemiring::multiply(dik, dkRow[j]);
+                                if (candidate < dRow[j]) {
+                                    dRow[j] = candidate;
+                                    pRow[j] = pkRow[j];
+                                    localChanged = true;
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        }
+        if (localChanged) changed = true;
+    }, numThreads);
+    return changed;
+}
+
+/**
+ * All-Pairs Shortest Paths by Repeated Min-Plus Squaring
+ * Time Complexity: O(n³ log d / threads), d = number of edges on the longest shortest path
+ * Space Complexity: O(n²) for one distance/predecessor workspace
+ * 
+ * Algorithm Steps:
+ * 1. D = W with D[i][i] = 0; P[i][j] = i for every edge, -1 otherwise
+ * 2. Square D in the min-plus semiring: after s squarings D holds the
+ *    shortest paths with at most 2^s edges
+ * 3. Stop as soon as a squaring changes nothing (or after ⌈log₂ n⌉,
+ *    once walks of n edges — long enough to close any cycle — are covered)
+ * 4. Report a negative cycle if any D[i][i] drops below zero
+ * 
+ * weights uses SEMIRING_INFINITY for missing edges. Returns the number of
+ * squarings performed, or -1 if the graph has a negative cycle.
+ * 
+ * Memory Optimization:
+ * - One workspace pair is allocated up front and ping-ponged with the
+ *   output buffers, so no squaring allocates
+ * - Every squaring runs row-parallel and cache-blocked
+ */
+int allPairsShortestPaths(long long** weights, long long** dist, long long** pred, int n, int numThreads = 0) {
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            dist[i][j] = (i == j) ? std::min(0LL, weights[i][j]) : weights[i][j];
+            pred[i][j] = (i != j && weights[i][j] < SEMIRING_INFINITY) ? i : -1;
+        }
+    }
+
+    long long** distWork = allocateMatrix(n);
+    long long** predWork = allocateMatrix(n);
+    long long** currentDist = dist;
+    long long** currentPred = pred;
+    long long** nextDist = distWork;
+    long long** nextPred = predWork;
+
+    int squarings = 0;
+    for (long long reach = 1; reach < n; reach *= 2) {
+        bool changed = minPlusSquareWithPredecessors(currentDist, currentPred, nextDist, nextPred, n, numThreads);
+        squarings++;
+        std::swap(currentDist, nextDist);
+        std::swap(currentPred, nextPred);
+        if (!changed) break;
+    }
+
+    if (currentDist != dist) {
+        for (int i = 0; i < n; i++) {
+            std::memcpy(dist[i], currentDist[i], static_cast<size_t>(n) * sizeof(long long));
+            std::memcpy(pred[i], currentPred[i], static_cast<size_t>(n) * sizeof(long long));
+        }
+    }
+    freeMatrix(distWork);
+    freeMatrix(predWork);
+
+    for (int i = 0; i < n; i++) {
+        if (dist[i][i] < 0) return -1;
+    }
+    return squarings;
+}
+
+/**
+ * Shortest Path Reconstruction
+ * Time Complexity: O(path length)
+ * Space Complexity: O(path length)
+ * 
+ * Follows pred[source][·] back from target. Returns the vertices from
+ * source to target, or an empty path if target is unreachable.
+ */
+std::vector<int> reconstructPath(long long** pred, int source, int target) {
+    std::vector<int> path;
+    if (source != target && pred[source][target] < 0) return path;
+    for (int v = target; v != source; v = static_cast<int>(pred[source][v])) {
+        path.push_back(v);
+        if (pred[source][v] < 0) return {};
+    }
+    path.push_back(source);
+    std::reverse(path.begin(), path.end());
+    return path;
+}
+
+/**
+ * Floyd-Warshall All-Pairs Shortest Paths
+ * Time Complexity: O(n³)
+ * Space Complexity: O(1)
+ * 
+ * Reference baseline for allPairsShortestPaths.
+ */
+void floydWarshall(long long** weights, long long** dist, int n) {
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            dist[i][j] = (i == j) ? std::min(0LL, weights[i][j]) : weights[i][j];
+        }
+    }
+    for (int k = 0; k < n; k++) {
+        for (int i = 0; i < n; i++) {
+            const long long dik = dist[i][k];
+            if (dik >= SEMIRING_INFINITY) continue;
+            for (int j = 0; j < n; j++) {
+                dist[i][j] = std::min(dist[i][j], MinPlusSemiring::multiply(dik, dist[k][j]));
+            }
+        }
+    }
+}
+
+/**
+ * Binary Matrix File Format
+ * 
+ * Layout (little-endian, as written by the host):
+ * - 4 bytes  magic "BFMX"
+ * - 4 bytes  format version
+ * - 8 bytes  row count
+ * - 8 bytes  column count
+ * - rows × cols 64-bit elements in row-major order
+ * 
+ * The fixed-size header lets any element (i, j) be located with a single
+ * seek, which is what the out-of-core engine relies on to read tiles.
+ */
+const char MATRIX_FILE_MAGIC[4] = {'B', 'F', 'M', 'X'};
+const std::int32_t MATRIX_FILE_VERSION = 1;
+const std::streamoff MATRIX_FILE_HEADER_SIZE = 24;
+
+bool writeMatrixHeader(std::ostream& out, std::int64_t rows, std::int64_t cols) {
+    out.write(MATRIX_FILE_MAGIC, sizeof(MATRIX_FILE_MAGIC));
+    out.write(reinterpret_cast<const char*>(&MATRIX_FILE_VERSION), sizeof(MATRIX_FILE_VERSION));
+    out.write(reinterpret_cast<const char*>(&rows), sizeof(rows));
+    out.write(reinterpret_cast<const char*>(&cols), sizeof(cols));
+    return static_cast<bool>(out);
+}
+
+bool readMatrixHeader(std::istream& in, std::int64_t& rows, std::int64_t& cols) {
+    char magic[4];
+    std::int32_t version = 0;
+    in.read(magic, sizeof(magic));
+    in.read(reinterpret_cast<char*>(&version), sizeof(version));
+    in.read(reinterpret_cast<char*>(&rows), sizeof(rows));
+    in.read(reinterpret_cast<char*>(&cols), sizeof(cols));
+    return in && std::memcmp(magic, MATRIX_FILE_MAGIC, sizeof(magic)) == 0 &&
+           version == MATRIX_FILE_VERSION && rows >= 0 && cols >= 0;
+}
+
+/**
+ * Write Matrix to Binary File
+ * Time Complexity: O(rows × cols)
+ * Space Complexity: O(1)
+ * 
+ * Algorithm Steps:
+ * 1. Write the fixed-size header
+ * 2. Write each row as one contiguous block
+ */
+bool writeMatrixFile(const std::string& path, long long** matrix, int rows, int cols) {
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out || !writeMatrixHeader(out, rows, cols)) return false;
+    for (int i = 0; i < rows; i++) {
+        out.write(reinterpret_cast<const char*>(matrix[i]), static_cast<std::streamsize>(cols) * sizeof(long long));
+    }
+    return static_cast<bool>(out);
+}
+
+/**
+ * Read Matrix from Binary File
+ * Time Complexity: O(rows × cols)
+ * Space Complexity: O(1)
+ * 
+ * Algorithm Steps:
+ * 1. Read and validate the header against the expected dimensions
+ * 2. Read each row directly into the destination matrix
+ */
+bool readMatrixFile(const std::string& path, long long** matrix, int rows, int cols) {
+    std::ifstream in(path, std::ios::binary);
+    std::int64_t fileRows = 0, fileCols = 0;
+    if (!in || !readMatrixHeader(in, fileRows, fileCols)) return false;
+    if (fileRows != rows || fileCols != cols) return false;
+    for (int i = 0; i < rows; i++) {
+        in.read(reinterpret_cast<char*>(matrix[i]), static_cast<std::streamsize>(cols) * sizeof(long long));
+    }
+    return static_cast<bool>(in);
+}
+
+const int HASH_LANES = 8;
+const int HASH_STRIPES_PER_BLOCK = 8;
+
+/**
+ * Per-stripe lane keys for MatrixHasher, one per (stripe in block, lane).
+ */
+const std::uint64_t* matrixHashSecret() {
+    static const std::vector<std::uint64_t> secret = [] {
+        std::vector<std::uint64_t> keys(HASH_LANES * HASH_STRIPES_PER_BLOCK);
+        for (size_t i = 0; i < keys.size(); i++) keys[i] = splitMix64(0x6d617472697848ULL + i);
+        return keys;
+    }();
+    return secret.data();
+}
+
+/**
+ * Hash Stripe Kernels
+ * One stripe is HASH_LANES values; lane l takes x = data[l] and k = x ^ key[l], then does
+ * acc[l] += lo32(k) × hi32(k) and acc[l ^ 1] += x.
+ * The 32 × 32 → 64 multiply is the one 64-bit-lane multiply x86 vectors have
+ * (pmuludq), so the AVX2 kernel consumes eight values in two registers per step.
+ * Both kernels compute the same function.
+ */
+void hashStripesScalar(std::uint64_t* acc, const long long* data, int stripes, const std::uint64_t* keys) {
+    for (int s = 0; s < stripes; s++) {
+        const std::uint64_t* key = keys + s * HASH_LANES;
+        for (int l = 0; l < HASH_LANES; l++) {
+            const std::uint64_t x = static_cast<std::uint64_t>(data[s * HASH_LANES + l]);
+            const std::uint64_t k = x ^ key[l];
+            acc[l] += (k & 0xffffffffULL) * (k >> 32);
+            acc[l ^ 1] += x;
+        }
+    }
+}
+
+#if defined(__GNUC__) && defined(__x86_64__)
+__attribute__((target("avx2")))
+void hashStripesAvx2(std::uint64_t* acc, const long long* data, int stripes, const std::uint64_t* keys) {
+    __m256i acc0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(acc));
+    __m256i acc1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(acc + 4));
+    for (int s = 0; s < stripes; s++) {
+        const __m256i x0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + s * HASH_LANES));
+        const __m256i x1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + s * HASH_LANES + 4));
+        const __m256i k0 = _mm256_xor_si256(x0, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(keys + s * HASH_LANES)));
+        const __m256i k1 = _mm256_xor_si256(x1, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(keys + s * HASH_LANES + 4)));
+        acc0 = _mm256_add_epi64(acc0, _mm256_mul_epu32(k0, _mm256_srli_epi64(k0, 32)));
+        acc1 = _mm256_add_epi64(acc1, _mm256_mul_epu32(k1, _mm256_srli_epi64(k1, 32)));
+        // Swap neighbouring 64-bit lanes: l ^ 1
+        acc0 = _mm256_add_epi64(acc0, _mm256_shuffle_epi32(x0, _MM_SHUFFLE(1, 0, 3, 2)));
+        acc1 = _mm256_add_epi64(acc1, _mm256_shuffle_epi32(x1, _MM_SHUFFLE(1, 0, 3, 2)));
+    }
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(acc), acc0);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(acc + 4), acc1);
+}
+
+bool cpuSupportsAvx2() {
+    static const bool supported = __builtin_cpu_supports("avx2");
+    return supported;
+}
+#endif
+
+/**
+ * 128-bit digest of a matrix's contents.
+ */
+struct MatrixDigest {
+    std::uint64_t low = 0;
+    std::uint64_t high = 0;
+
+    bool operator==(const MatrixDigest& other) const { return low == other.low && high == other.high; }
+};
+
+/**
+ * Streaming Multi-Lane Matrix Hash
+ * Time Complexity: O(rows × cols), a few instructions per element
+ * Space Complexity: O(1)
+ * 
+ * Algorithm Steps:
+ * 1. Feed the elements row-major as one stream; eight independent lane
+ *    accumulators take one stripe of eight values at a time
+ * 2. Each stripe in a block of HASH_STRIPES_PER_BLOCK uses its own lane
+ *    keys, so values swapped between stripes change the result
+ * 3. After every block, scramble each accumulator
+ *    (acc ^= acc >> 47, acc ^= key, acc *= 2^32 - 5), making order matter
+ *    across blocks
+ * 4. Finish: pad the last partial stripe, then fold the lanes, the
+ *    element count and the shape through splitMix64 twice with different
+ *    seeds for a 128-bit digest
+ * 
+ * Fast, not cryptographic: it guards against accidental collisions
+ * between real inputs, not crafted ones.
+ */
+class MatrixHasher {
+public:
+    MatrixHasher() {
+        const std::uint64_t* secret = matrixHashSecret();
+        for (int l = 0; l < HASH_LANES; l++) acc_[l] = secret[l] ^ 0x9e3779b97f4a7c15ULL;
+    }
+
+    void update(const long long* data, size_t count) {
+        count_ += count;
+        // Top up a partial stripe first
+        while (buffered_ > 0 && count > 0) {
+            buffer_[buffered_++] = *data++;
+            count--;
+            if (buffered_ == HASH_LANES) {
+                consume(buffer_, 1);
+                buffered_ = 0;
+            }
+        }
+        while (count >= HASH_LANES) {
+            const int stripes = static_cast<int>(std::min<size_t>(count / HASH_LANES, HASH_STRIPES_PER_BLOCK - stripe_));
+            consume(data, stripes);
+            data += static_cast<size_t>(stripes) * HASH_LANES;
+            count -= static_cast<size_t>(stripes) * HASH_LANES;
+        }
+        for (; count > 0; count--) buffer_[buffered_++] = *data++;
+    }
+
+    MatrixDigest finish(int rows, int cols) {
+        if (buffered_ > 0) {
+            std::fill(buffer_ + buffered_, buffer_ + HASH_LANES, 0LL);
+            consume(buffer_, 1);
+            buffered_ = 0;
+        }
+        MatrixDigest digest;
+        std::uint64_t low = count_ ^ (static_cast<std::uint64_t>(rows) << 32 | static_cast<std::uint32_t>(cols));
+        std::uint64_t high = ~low;
+        for (int l = 0; l < HASH_LANES; l++) {
+            low = splitMix64(low ^ acc_[l]);
+            high = splitMix64(high + acc_[l] * 0xff51afd7ed558ccdULL);
+        }
+        digest.low = low;
+        digest.high = high;
+        return digest;
+    }
+
+private:
+    // stripes never crosses a block boundary
+    void consume(const long long* data, int stripes) {
+        const std::uint64_t* keys = matrixHashSecret() + stripe_ * HASH_LANES;
+#if defined(__GNUC__) && defined(__x86_64__)
+        if (cpuSupportsAvx2()) {
+            hashStripesAvx2(acc_, data, stripes, keys);
+        } else {
+            hashStripesScalar(acc_, data, stripes, keys);
+        }
+#else
+        hashStripesScalar(acc_, data, stripes, keys);
+#endif
+        stripe_ += stripes;
+        if (stripe_ == HASH_STRIPES_PER_BLOCK) {
+            const std::uint64_t* secret = matrixHashSecret();
+            for (int l = 0; l < HASH_LANES; l++) {
+                acc_[l] ^= acc_[l] >> 47;
+                acc_[l] ^= secret[HASH_LANES + l];
+                acc_[l] *= 0xfffffffbULL;
+            }
+            stripe_ = 0;
+        }
+    }
+
+    std::uint64_t acc_[HASH_LANES];
+    long long buffer_[HASH_LANES];
+    int buffered_ = 0;
+    int stripe_ = 0;
+    std::uint64_t count_ = 0;
+};
+
+MatrixDigest hashMatrix(long long** matrix, int rows, int cols) {
+    MatrixHasher hasher;
+    for (int i = 0; i < rows; i++) hasher.update(matrix[i], static_cast<size_t>(cols));
+    return hasher.finish(rows, cols);
+}
+
+/**
+ * Identity of a cached product: both operands' digests, the shape, the
+ * engine that computed it and the element type it was computed in.
+ */
+struct ProductKey {
+    MatrixDigest a;
+    MatrixDigest b;
+    int n = 0;
+    std::string engine;
+    std::string elementType = "int64";
+
+    std::string fileName() const {
+        char name[160];
+        std::snprintf(name, sizeof(name), "%016llx%016llx-%016llx%016llx-%d",
+                      static_cast<unsigned long long>(a.high), static_cast<unsigned long long>(a.low),
+                      static_cast<unsigned long long>(b.high), static_cast<unsigned long long>(b.low), n);
+        return std::string(name) + "-" + engine + "-" + elementType + ".bfmx";
+    }
+};
+
+/**
+ * Counters reported by ProductCache.
+ */
+struct ProductCacheStats {
+    long long memoryHits = 0;
+    long long diskHits = 0;
+    long long misses = 0;
+    long long evictions = 0;
+};
+
+/**
+ * Content-Addressed Product Cache
+ * An in-memory LRU of products bounded by total bytes, in front of an
+ * optional directory of products in the binary matrix format.
+ * 
+ * - lookup checks memory, then disk; a disk hit is promoted to memory
+ * - insert stores in memory (evicting least recently used entries past
+ *   the byte budget) and writes through to disk, via a temporary file and
+ *   a rename so readers never see a partial product
+ * - A product larger than the whole budget is only stored on disk
+ */
+class ProductCache {
+public:
+    explicit ProductCache(size_t memoryBudgetBytes, std::string diskDirectory = "")
+        : budget_(memoryBudgetBytes), directory_(std::move(diskDirectory)) {
+        if (!directory_.empty()) std::filesystem::create_directories(directory_);
+    }
+
+    bool lookup(const ProductKey& key, long long** C) {
+        const std::string name = key.fileName();
+        auto found = index_.find(name);
+        if (found != index_.end()) {
+            lru_.splice(lru_.begin(), lru_, found->second);
+            const std::vector<long long>& data = found->second->data;
+            for (int i = 0; i < key.n; i++) {
+                std::memcpy(C[i], data.data() + static_cast<size_t>(i) * key.n, static_cast<size_t>(key.n) * sizeof(long long));
+            }
+            stats_.memoryHits++;
+            return true;
+        }
+        if (!directory_.empty() && readMatrixFile((std::filesystem::path(directory_) / name).string(), C, key.n, key.n)) {
+            stats_.diskHits++;
+            storeInMemory(name, C, key.n);
+            return true;
+        }
+        stats_.misses++;
+        return false;
+    }
+
+    void insert(const ProductKey& key, long long** C) {
+        const std::string name = key.fileName();
+        storeInMemory(name, C, key.n);
+        if (directory_.empty()) return;
+        const std::filesystem::path path = std::filesystem::path(directory_) / name;
+        const std::filesystem::path temporary = path.string() + ".tmp" + std::to_string(reinterpret_cast<std::uintptr_t>(this));
+        if (writeMatrixFile(temporary.string(), C, key.n, key.n)) {
+            std::error_code error;
+            std::filesystem::rename(temporary, path, error);
+            if (error) std::filesystem::remove(temporary, error);
+        }
+    }
+
+    const ProductCacheStats& stats() const { return stats_; }
+    size_t memoryBytes() const { return bytes_; }
+
+private:
+    struct Entry {
+        std::string name;
+        std::vector<long long> data;
+    };
+
+    void storeInMemory(const std::string& name, long long** C, int n) {
+        const size_t bytes = static_cast<size_t>(n) * n * sizeof(long long);
+        auto found = index_.find(name);
+        if (found != index_.end()) {
+            lru_.splice(lru_.begin(), lru_, found->second);
+            return;
+        }
+        if (bytes > budget_) return;
+        while (bytes_ + bytes > budget_) {
+            bytes_ -= lru_.back().data.size() * sizeof(long long);
+            index_.erase(lru_.back().name);
+            lru_.pop_back();
+            stats_.evictions++;
+        }
+        Entry entry;
+        entry.name = name;
+        entry.data.resize(static_cast<size_t>(n) * n);
+        for (int i = 0; i < n; i++) std::copy(C[i], C[i] + n, entry.data.begin() + static_cast<size_t>(i) * n);
+        lru_.push_front(std::move(entry));
+        index_[name] = lru_.begin();
+        bytes_ += bytes;
+    }
+
+    size_t budget_;
+    std::string directory_;
+    size_t bytes_ = 0;
+    std::list<Entry> lru_;
+    std::unordered_map<std::string, std::list<Entry>::iterator> index_;
+    ProductCacheStats stats_;
+};
+
+/**
+ * Cached Multiplication
+ * Time Complexity: O(n²) to hash on a hit; a hit then costs one copy
+ * Space Complexity: that of the engine on a miss
+ * 
+ * Hashes A and B, looks the product up under the given engine name, and
+ * only on a miss runs multiply and caches its result. Returns true on a
+ * hit. The engine name is part of the key, so engines whose results could
+ * differ (for example on overflow) never share entries.
+ */
+bool matrixMultiplyCached(ProductCache& cache, const std::string& engine,
+                          const std::function<void(long long**, long long**, long long**, int)>& multiply,
+                          long long** A, long long** B, long long** C, int n) {
+    ProductKey key;
+    key.a = hashMatrix(A, n, n);
+    key.b = hashMatrix(B, n, n);
+    key.n = n;
+    key.engine = engine;
+    if (cache.lookup(key, C)) return true;
+    multiply(A, B, C, n);
+    cache.insert(key, C);
+    return false;
+}
+
+bool matrixMultiplyCached(ProductCache& cache, long long** A, long long** B, long long** C, int n, int numThreads = 0) {
+    return matrixMultiplyCached(cache, "planned", [numThreads](long long** a, long long** b, long long** c, int size) {
+        matrixMultiply(a, b, c, size, numThreads);
+    }, A, B, C, n);
+}
+
+/**
+ * Checkpointing options for the resumable engines.
+ * - directory holds the manifest and completed work; a run that finds a
+ *   manifest for the same inputs resumes from it
+ * - completed work is made durable at most every intervalSeconds (0 makes
+ *   every completed unit durable at once)
+ * - stopRequested is polled between units; returning true makes the
+ *   engine checkpoint and return early, as a preempted job would
+ */
+struct CheckpointOptions {
+    std::string directory;
+    double intervalSeconds = 60.0;
+    std::function<bool()> stopRequested;
+    bool removeOnCompletion = true;
+};
+
+struct CheckpointStats {
+    int unitsTotal = 0;
+    int unitsResumed = 0;
+    int unitsComputed = 0;
+    int checkpointsWritten = 0;
+};
+
+/**
+ * Flush a file's data to stable storage. Process death alone would not
+ * lose page-cache data, but a preempted node can lose the machine.
+ * Returns false if the file could not be opened or synced.
+ */
+bool syncFile(const std::string& path) {
+#if defined(__unix__)
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+    const bool synced = ::fsync(fd) == 0;
+    ::close(fd);
+    return synced;
+#else
+    (void)path;
+    return true;
+#endif
+}
+
+/**
+ * Replace path with contents so that readers see the old or the new file,
+ * never a mix: write a temporary, sync it, rename it over path.
+ */
+bool writeFileAtomically(const std::string& path, const std::string& contents) {
+    const std::string temporary = path + ".tmp";
+    {
+        std::ofstream out(temporary, std::ios::binary | std::ios::trunc);
+        out << contents;
+        if (!out) return false;
+    }
+    if (!syncFile(temporary)) return false;
+    std::error_code error;
+    std::filesystem::rename(temporary, path, error);
+    return !error;
+}
+
+/**
+ * Checkpoint Manifest
+ * Plain text: the engine, n, the unit size, the input digests and the
+ * completed units, each with the digest of its data. It is the commit
+ * point of a checkpoint — work not listed here is redone on resume, so
+ * data must be durable before the manifest that lists it is renamed into
+ * place; the unit digests catch data that changed or vanished since.
+ */
+struct CheckpointManifest {
+    struct Unit {
+        int id = 0;
+        MatrixDigest digest;
+    };
+
+    std::string engine;
+    int n = 0;
+    int unitSize = 0;
+    MatrixDigest a;
+    MatrixDigest b;
+    std::vector<Unit> done;
+
+    std::string serialize() const {
+        std::string text = "matrix-checkpoint 2\nengine " + engine + "\nn " + std::to_string(n) + "\nunit " +
+                           std::to_string(unitSize) + "\ndigests " + std::to_string(a.low) + " " + std::to_string(a.high) +
+                           " " + std::to_string(b.low) + " " + std::to_string(b.high) + "\ndone";
+        for (const Unit& unit : done) {
+            text += "\n" + std::to_string(unit.id) + " " + std::to_string(unit.digest.low) + " " + std::to_string(unit.digest.high);
+        }
+        return text + "\n";
+    }
+
+    // True if the manifest at path describes the same computation
+    bool loadMatching(const std::string& path) {
+        std::ifstream in(path);
+        std::string magic, key, fileEngine;
+        int version = 0, fileN = 0, fileUnit = 0;
+        MatrixDigest fileA, fileB;
+        if (!(in >> magic >> version) || magic != "matrix-checkpoint" || version != 2) return false;
+        if (!(in >> key >> fileEngine) || key != "engine") return false;
+        if (!(in >> key >> fileN) || key != "n") return false;
+        if (!(in >> key >> fileUnit) || key != "unit") return false;
+        if (!(in >> key >> fileA.low >> fileA.high >> fileB.low >> fileB.high) || key != "digests") return false;
+        if (!(in >> key) || key != "done") return false;
+        if (fileEngine != engine || fileN != n || fileUnit != unitSize || !(fileA == a) || !(fileB == b)) return false;
+        done.clear();
+        for (Unit unit; in >> unit.id >> unit.digest.low >> unit.digest.high;) done.push_back(unit);
+        return true;
+    }
+};
+
+/**
+ * Drives units of work and checkpoints: the part of checkpointing the
+ * tiled and Strassen engines share.
+ * - A matching manifest's units are only listed at first; the engine
+ *   reads each one back and calls restore with the digest of what it
+ *   read, and only units whose digest matches count as done. finishRestore
+ *   then rewrites the manifest with just those
+ * - completed records a computed unit with the digest of its data; at a
+ *   checkpoint, persist makes the data of the pending units durable and
+ *   the manifest is written after it. If persist fails, the units stay
+ *   pending and are retried at the next checkpoint, never listed unwritten
+ */
+class CheckpointDriver {
+public:
+    using Persist = std::function<bool(const std::vector<int>&)>;
+
+    CheckpointDriver(const CheckpointOptions& options, CheckpointManifest manifest, int unitsTotal)
+        : options_(options), manifest_(std::move(manifest)), done_(unitsTotal, false),
+          lastCheckpoint_(std::chrono::steady_clock::now()) {
+        stats_.unitsTotal = unitsTotal;
+        std::filesystem::create_directories(options_.directory);
+        CheckpointManifest existing = manifest_;
+        manifest_.done.clear();
+        if (existing.loadMatching(manifestPath())) {
+            for (const CheckpointManifest::Unit& unit : existing.done) {
+                if (unit.id >= 0 && unit.id < unitsTotal) listed_.push_back(unit);
+            }
+        }
+    }
+
+    bool isDone(int unit) const { return done_[unit]; }
+    // Units the manifest lists as done, not yet checked by restore
+    const std::vector<CheckpointManifest::Unit>& listedUnits() const { return listed_; }
+    std::string path(const std::string& name) const { return (std::filesystem::path(options_.directory) / name).string(); }
+
+    // Accept a listed unit if the data read back has the digest the manifest recorded
+    bool restore(int unit, const MatrixDigest& digest) {
+        if (done_[unit]) return true;
+        for (const CheckpointManifest::Unit& listed : listed_) {
+            if (listed.id != unit || !(listed.digest == digest)) continue;
+            done_[unit] = true;
+            manifest_.done.push_back(listed);
+            stats_.unitsResumed++;
+            return true;
+        }
+        return false;
+    }
+
+    // Replace the manifest with the restored units only; a stale checkpoint from other inputs is dropped here too
+    void finishRestore() {
+        writeFileAtomically(manifestPath(), manifest_.serialize());
+        listed_.clear();
+    }
+
+    // Record a computed unit; checkpoint if the interval has passed. False means stop now.
+    bool completed(int unit, const MatrixDigest& digest, const Persist& persist) {
+        if (!done_[unit]) {
+            done_[unit] = true;
+            pending_.push_back({unit, digest});
+            stats_.unitsComputed++;
+        }
+        const bool stop = options_.stopRequested && options_.stopRequested();
+        const double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - lastCheckpoint_).count();
+        if (stop || elapsed >= options_.intervalSeconds) checkpoint(persist);
+        return !stop;
+    }
+
+    void checkpoint(const Persist& persist) {
+        if (pending_.empty()) return;
+        std::vector<int> units;
+        for (const CheckpointManifest::Unit& unit : pending_) units.push_back(unit.id);
+        if (!persist(units)) return;
+        manifest_.done.insert(manifest_.done.end(), pending_.begin(), pending_.end());
+        writeFileAtomically(manifestPath(), manifest_.serialize());
+        pending_.clear();
+        stats_.checkpointsWritten++;
+        lastCheckpoint_ = std::chrono::steady_clock::now();
+    }
+
+    void finish() {
+        if (options_.removeOnCompletion) {
+            std::error_code error;
+            std::filesystem::remove_all(options_.directory, error);
+        }
+    }
+
+    const CheckpointStats& stats() const { return stats_; }
+
+private:
+    std::string manifestPath() const { return path("manifest.txt"); }
+
+    const CheckpointOptions& options_;
+    CheckpointManifest manifest_;
+    std::vector<bool> done_;
+    std::vector<CheckpointManifest::Unit> listed_;
+    std::vector<CheckpointManifest::Unit> pending_;
+    std::chrono::steady_clock::time_point lastCheckpoint_;
+    CheckpointStats stats_;
+};
+
+const int CHECKPOINT_TILE_ROWS = 64;
+
+/**
+ * Checkpointed Tiled Multiplication
+ * Time Complexity: O(n³ / threads), minus resumed units
+ * Space Complexity: O(n²) on disk for the output file
+ * 
+ * Algorithm Steps:
+ * 1. Units are bands of CHECKPOINT_TILE_ROWS rows of C
+ * 2. On start, a manifest for the same n, band size and input digests
+ *    means its bands are read back from the output file; a band is
+ *    skipped only if it reads and matches its recorded digest, and is
+ *    recomputed otherwise. Without one, or if the output file has the
+ *    wrong size, a fresh output file (binary matrix format) is created
+ * 3. Pending bands are taken one per thread and computed concurrently,
+ *    each a matrixMultiplyRectangular call on row views of A and C; a
+ *    band of 64 rows is too short to spread over many threads itself
+ * 4. At each checkpoint, newly finished bands are written at their
+ *    offsets in the output file and synced, then the manifest is replaced;
+ *    a failed write leaves them for the next checkpoint
+ * 
+ * The band size does not depend on the thread count, so a run may be
+ * resumed with a different number of threads.
+ * Returns true when C is complete, false if stopRequested cut the run
+ * short (the finished bands are checkpointed first).
+ */
+bool matrixMultiplyTiledCheckpointed(long long** A, long long** B, long long** C, int n, const CheckpointOptions& options,
+                                     CheckpointStats* stats = nullptr, int numThreads = 0) {
+    CheckpointManifest manifest;
+    manifest.engine = "tiled";
+    manifest.n = n;
+    manifest.unitSize = CHECKPOINT_TILE_ROWS;
+    manifest.a = hashMatrix(A, n, n);
+    manifest.b = hashMatrix(B, n, n);
+    const int bands = (n + CHECKPOINT_TILE_ROWS - 1) / CHECKPOINT_TILE_ROWS;
+    CheckpointDriver driver(options, manifest, bands);
+    const std::string outputPath = driver.path("c.bfmx");
+    const size_t rowBytes = static_cast<size_t>(n) * sizeof(long long);
+
+    const std::uintmax_t fileBytes = MATRIX_FILE_HEADER_SIZE + rowBytes * n;
+    std::error_code sizeError;
+    auto bandDigest = [&](int band) {
+        const int i0 = band * CHECKPOINT_TILE_ROWS;
+        return hashMatrix(C + i0, std::min(n, i0 + CHECKPOINT_TILE_ROWS) - i0, n);
+    };
+    if (driver.listedUnits().empty() || std::filesystem::file_size(outputPath, sizeError) != fileBytes) {
+        std::ofstream out(outputPath, std::ios::binary | std::ios::trunc);
+        writeMatrixHeader(out, n, n);
+        out.close();
+        std::filesystem::resize_file(outputPath, fileBytes, sizeError);
+    } else {
+        std::ifstream in(outputPath, std::ios::binary);
+        for (const CheckpointManifest::Unit& unit : driver.listedUnits()) {
+            const int i0 = unit.id * CHECKPOINT_TILE_ROWS;
+            const int i1 = std::min(n, i0 + CHECKPOINT_TILE_ROWS);
+            in.clear();
+            in.seekg(static_cast<std::streamoff>(MATRIX_FILE_HEADER_SIZE + rowBytes * i0));
+            for (int i = i0; i < i1; i++) in.read(reinterpret_cast<char*>(C[i]), static_cast<std::streamsize>(rowBytes));
+            if (in) driver.restore(unit.id, bandDigest(unit.id));
+        }
+    }
+    driver.finishRestore();
+
+    auto persist = [&](const std::vector<int>& finished) {
+        {
+            std::fstream out(outputPath, std::ios::binary | std::ios::in | std::ios::out);
+            for (int band : finished) {
+                const int i0 = band * CHECKPOINT_TILE_ROWS;
+                const int i1 = std::min(n, i0 + CHECKPOINT_TILE_ROWS);
+                out.seekp(static_cast<std::streamoff>(MATRIX_FILE_HEADER_SIZE + rowBytes * i0));
+                for (int i = i0; i < i1; i++) out.write(reinterpret_cast<const char*>(C[i]), static_cast<std::streamsize>(rowBytes));
+            }
+            if (!out.flush()) return false;
+        }
+        return syncFile(outputPath);
+    };
+
+    const int threads = numThreads > 0 ? numThreads : defaultThreadCount();
+    std::vector<int> pending;
+    for (int band = 0; band < bands; band++) {
+        if (!driver.isDone(band)) pending.push_back(band);
+    }
+    bool complete = true;
+    for (size_t first = 0; first < pending.size() && complete; first += threads) {
+        const int group = static_cast<int>(std::min(pending.size() - first, static_cast<size_t>(threads)));
+        const int threadsPerBand = std::max(1, threads / group);
+        parallelFor(0, group, [&](int begin, int end) {
+            for (int g = begin; g < end; g++) {
+                const int i0 = pending[first + g] * CHECKPOINT_TILE_ROWS;
+                const int rows = std::min(n, i0 + CHECKPOINT_TILE_ROWS) - i0;
+                matrixMultiplyRectangular(A + i0, B, C + i0, rows, n, n, threadsPerBand);
+            }
+        }, group);
+        // Every band of the group is finished, so all are recorded even if a stop arrives midway
+        for (int g = 0; g < group; g++) {
+            complete = driver.completed(pending[first + g], bandDigest(pending[first + g]), persist) && complete;
+        }
+        if (!complete) driver.checkpoint(persist);
+    }
+    if (stats) *stats = driver.stats();
+    if (complete) driver.finish();
+    return complete;
+}
+
+/**
+ * Checkpointed Strassen Multiplication
+ * Time Complexity: that of matrixMultiply on n/2, seven times, minus
+ *                  resumed products
+ * Space Complexity: O(n²) in memory and on disk
+ * 
+ * Algorithm Steps:
+ * 1. Form the top Winograd level with beginWinogradLevel; its seven
+ *    half-size products are the units
+ * 2. Products listed in a matching manifest are read back from their
+ *    files and kept if they match their recorded digest; the rest are
+ *    computed with matrixMultiply (planned, so deeper levels and the leaf
+ *    kernel are chosen as usual)
+ * 3. At each checkpoint, every newly finished product is written to its
+ *    own file via temporary file and rename, then the manifest is replaced
+ * 4. Once all seven exist, combine them with finishWinogradLevel
+ * 
+ * Odd n has no exact halving and is handed to the tiled engine.
+ * Returns true when C is complete.
+ */
+bool matrixMultiplyStrassenCheckpointed(long long** A, long long** B, long long** C, int n, const CheckpointOptions& options,
+                                        CheckpointStats* stats = nullptr, int numThreads = 0) {
+    if (n % 2 != 0) return matrixMultiplyTiledCheckpointed(A, B, C, n, options, stats, numThreads);
+    CheckpointManifest manifest;
+    manifest.engine = "strassen";
+    manifest.n = n;
+    manifest.unitSize = n / 2;
+    manifest.a = hashMatrix(A, n, n);
+    manifest.b = hashMatrix(B, n, n);
+    CheckpointDriver driver(options, manifest, 7);
+    auto productPath = [&](int p) { return driver.path("m" + std::to_string(p + 1) + ".bfmx"); };
+
+    WinogradLevel level;
+    beginWinogradLevel(level, A, B, C, n, numThreads);
+    const int half = level.half;
+    for (const CheckpointManifest::Unit& unit : driver.listedUnits()) {
+        const int p = unit.id;
+        if (readMatrixFile(productPath(p), level.M[p], half, half)) driver.restore(p, hashMatrix(level.M[p], half, half));
+    }
+    driver.finishRestore();
+
+    auto persist = [&](const std::vector<int>& finished) {
+        for (int p : finished) {
+            const std::string path = productPath(p);
+            if (!writeMatrixFile(path + ".tmp", level.M[p], half, half) || !syncFile(path + ".tmp")) return false;
+            std::error_code error;
+            std::filesystem::rename(path + ".tmp", path, error);
+            if (error) return false;
+        }
+        return true;
+    };
+
+    bool complete = true;
+    for (int p = 0; p < 7 && complete; p++) {
+        if (driver.isDone(p)) continue;  // A listed product that is unreadable or altered is recomputed
+        matrixMultiply(level.lhs[p], level.rhs[p], level.M[p], half, numThreads);
+        complete = driver.completed(p, hashMatrix(level.M[p], half, half), persist);
+    }
+    if (complete) {
+        finishWinogradLevel(level, numThreads, 1, 0);
+        driver.finish();
+    } else {
+        releaseWinogradLevel(level);
+    }
+    if (stats) *stats = driver.stats();
+    return complete;
+}
+
+/**
+ * I/O counters reported by the out-of-core engine.
+ * tilesReused counts operand tiles served from the other half of the
+ * double buffer instead of being read from disk again.
+ */
+struct OutOfCoreStats {
+    long long tilesRead = 0;
+    long long tilesReused = 0;
+    long long tilesWritten = 0;
+};
+
+// One half of the double buffer: a tile of A, a tile of B and their tile coordinates
+struct TilePair {
+    std::vector<long long> a;
+    std::vector<long long> b;
+    int aRow = -1, aCol = -1;
+    int bRow = -1, bCol = -1;
+};
+
+// One unit of out-of-core work: C(i, j) += A(i, k) * B(k, j) on tile coordinates
+struct TileStep {
+    int i, j, k;
+};
+
+/**
+ * Out-of-Core Tile Schedule
+ * Time Complexity: O(t³) where t = number of tiles per dimension
+ * Space Complexity: O(t³)
+ * 
+ * Algorithm Steps:
+ * 1. Visit output tiles row by row, reversing the column order on odd rows
+ * 2. Within each output tile, walk k forward and backward on alternate tiles
+ * 
+ * The serpentine order makes consecutive steps share an operand tile at
+ * every output-tile boundary: moving along a row keeps A(i, k), moving
+ * down a row keeps B(k, j), so that tile never has to be re-read.
+ */
+std::vector<TileStep> scheduleOutOfCoreTiles(int tiles) {
+    std::vector<TileStep> steps;
+    steps.reserve(static_cast<size_t>(tiles) * tiles * tiles);
+    int outputTile = 0;
+    for (int i = 0; i < tiles; i++) {
+        for (int jj = 0; jj < tiles; jj++) {
+            int j = (i % 2 == 0) ? jj : tiles - 1 - jj;
+            for (int kk = 0; kk < tiles; kk++) {
+                int k = (outputTile % 2 == 0) ? kk : tiles - 1 - kk;
+                steps.push_back({i, j, k});
+            }
+            outputTile++;
+        }
+    }
+    return steps;
+}
+
+/**
+ * Read one tile of an n×n matrix file into a buffer with row stride tileSize.
+ * Edge tiles are smaller; only their valid part is read.
+ */
+bool readMatrixTile(std::ifstream& in, int n, int tileRow, int tileCol, int tileSize, std::vector<long long>& tile) {
+    int rowStart = tileRow * tileSize;
+    int colStart = tileCol * tileSize;
+    int rows = std::min(tileSize, n - rowStart);
+    int cols = std::min(tileSize, n - colStart);
+    for (int r = 0; r < rows; r++) {
+        std::streamoff offset = MATRIX_FILE_HEADER_SIZE +
+            (static_cast<std::streamoff>(rowStart + r) * n + colStart) * static_cast<std::streamoff>(sizeof(long long));
+        in.seekg(offset);
+        in.read(reinterpret_cast<char*>(&tile[static_cast<size_t>(r) * tileSize]), static_cast<std::streamsize>(cols) * sizeof(long long));
+    }
+    return static_cast<bool>(in);
+}
+
+bool writeMatrixTile(std::fstream& out, int n, int tileRow, int tileCol, int tileSize, const std::vector<long long>& tile) {
+    int rowStart = tileRow * tileSize;
+    int colStart = tileCol * tileSize;
+    int rows = std::min(tileSize, n - rowStart);
+    int cols = std::min(tileSize, n - colStart);
+    for (int r = 0; r < rows; r++) {
+        std::streamoff offset = MATRIX_FILE_HEADER_SIZE +
+            (static_cast<std::streamoff>(rowStart + r) * n + colStart) * static_cast<std::streamoff>(sizeof(long long));
+        out.seekp(offset);
+        out.write(reinterpret_cast<const char*>(&tile[static_cast<size_t>(r) * tileSize]), static_cast<std::streamsize>(cols) * sizeof(long long));
+    }
+    return static_cast<bool>(out);
+}
+
+/**
+ * Fill one half of the double buffer with the operand tiles a step needs.
+ * A tile already present in this slot is kept; a tile present in the other
+ * slot (the one being computed on) is copied instead of re-read from disk.
+ */
+bool loadTilePair(std::ifstream& inA, std::ifstream& inB, int n, int tileSize, const TileStep& step,
+                  TilePair& slot, const TilePair& other, OutOfCoreStats& stats) {
+    if (slot.aRow != step.i || slot.aCol != step.k) {
+        if (other.aRow == step.i && other.aCol == step.k) {
+            slot.a = other.a;
+            stats.tilesReused++;
+        } else {
+            if (!readMatrixTile(inA, n, step.i, step.k, tileSize, slot.a)) return false;
+            stats.tilesRead++;
+        }
+        slot.aRow = step.i;
+        slot.aCol = step.k;
+    }
+    if (slot.bRow != step.k || slot.bCol != step.j) {
+        if (other.bRow == step.k && other.bCol == step.j) {
+            slot.b = other.b;
+            stats.tilesReused++;
+        } else {
+            if (!readMatrixTile(inB, n, step.k, step.j, tileSize, slot.b)) return false;
+            stats.tilesRead++;
+        }
+        slot.bRow = step.k;
+        slot.bCol = step.j;
+    }
+    return true;
+}
+
+/**
+ * The out-of-core engine's I/O thread: started once per run, it waits on a
+ * one-entry handoff slot. request posts the next step and the buffer half
+ * to fill; wait blocks until that load has finished and reports whether it
+ * succeeded. At most one request is outstanding, since there is only one
+ * idle half to fill.
+ */
+class TilePrefetcher {
+public:
+    TilePrefetcher(std::ifstream& inA, std::ifstream& inB, int n, int tileSize, OutOfCoreStats& stats)
+        : inA_(inA), inB_(inB), n_(n), tileSize_(tileSize), stats_(stats), thread_([this] { run(); }) {}
+
+    ~TilePrefetcher() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+        }
+        posted_.notify_one();
+        thread_.join();
+    }
+
+    void request(const TileStep& step, TilePair& slot, const TilePair& other) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            step_ = step;
+            slot_ = &slot;
+            other_ = &other;
+            pending_ = true;
+            finished_ = false;
+        }
+        posted_.notify_one();
+    }
+
+    bool wait() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        done_.wait(lock, [this] { return finished_; });
+        return loaded_;
+    }
+
+private:
+    void run() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        for (;;) {
+            posted_.wait(lock, [this] { return pending_ || stopping_; });
+            if (!pending_) return;
+            pending_ = false;
+            const TileStep step = step_;
+            TilePair& slot = *slot_;
+            const TilePair& other = *other_;
+            lock.unlock();
+            const bool loaded = loadTilePair(inA_, inB_, n_, tileSize_, step, slot, other, stats_);
+            lock.lock();
+            loaded_ = loaded;
+            finished_ = true;
+            done_.notify_one();
+        }
+    }
+
+    std::ifstream& inA_;
+    std::ifstream& inB_;
+    const int n_;
+    const int tileSize_;
+    OutOfCoreStats& stats_;
+    std::mutex mutex_;
+    std::condition_variable posted_;
+    std::condition_variable done_;
+    TileStep step_ = {0, 0, 0};
+    TilePair* slot_ = nullptr;
+    const TilePair* other_ = nullptr;
+    bool pending_ = false;
+    bool finished_ = false;
+    bool loaded_ = false;
+    bool stopping_ = false;
+    std::thread thread_;  // Last, so it starts after the members it uses
+};
+
+/**
+ * Out-of-Core Tiled Matrix Multiplication
+ * Time Complexity: O(n³) compute, O(n³ / tileSize) elements read from disk
+ * Space Complexity: O(tileSize²) — independent of n
+ * 
+ * Algorithm Steps:
+ * 1. Validate the headers of the A and B files and create the C file
+ * 2. Build the serpentine tile schedule
+ * 3. For each step, a persistent I/O thread (TilePrefetcher) loads the
+ *    next step's A and B tiles into the idle half of the double buffer
+ *    while the current step multiplies the tiles in the other half
+ * 4. Accumulate into one in-memory C tile and write it once its k loop ends
+ * 
+ * Memory Optimization:
+ * - Only four operand tiles and one output tile are resident at a time
+ * - Each C tile is written exactly once and never read back
+ * - Operand tiles shared by consecutive steps are reused, not re-read
+ * - Disk reads overlap with computation through double buffering
+ */
+bool matrixMultiplyOutOfCore(const std::string& pathA, const std::string& pathB, const std::string& pathC,
+                             int tileSize, OutOfCoreStats* stats = nullptr) {
+    std::ifstream inA(pathA, std::ios::binary);
+    std::ifstream inB(pathB, std::ios::binary);
+    std::int64_t rowsA = 0, colsA = 0, rowsB = 0, colsB = 0;
+    if (!inA || !inB || !readMatrixHeader(inA, rowsA, colsA) || !readMatrixHeader(inB, rowsB, colsB)) return false;
+    if (rowsA != colsA || rowsB != colsB || rowsA != rowsB || tileSize <= 0) return false;
+    const int n = static_cast<int>(rowsA);
+
+    // Create the output file at its full size so tiles can be written in any order
+    {
+        std::ofstream create(pathC, std::ios::binary | std::ios::trunc);
+        if (!create || !writeMatrixHeader(create, n, n)) return false;
+    }
+    std::error_code error;
+    std::filesystem::resize_file(pathC, MATRIX_FILE_HEADER_SIZE + static_cast<std::uintmax_t>(n) * n * sizeof(long long), error);
+    if (error) return false;
+    std::fstream outC(pathC, std::ios::binary | std::ios::in | std::ios::out);
+    if (!outC) return false;
+
+    OutOfCoreStats localStats;
+    const int tiles = (n + tileSize - 1) / tileSize;
+    const size_t tileElements = static_cast<size_t>(tileSize) * tileSize;
+    std::vector<TileStep> steps = scheduleOutOfCoreTiles(tiles);
+
+    TilePair buffers[2];
+    for (TilePair& buffer : buffers) {
+        buffer.a.assign(tileElements, 0);
+        buffer.b.assign(tileElements, 0);
+    }
+    std::vector<long long> tileC(tileElements, 0);
+
+    if (!steps.empty() && !loadTilePair(inA, inB, n, tileSize, steps[0], buffers[0], buffers[1], localStats)) return false;
+
+    bool ok = true;
+    TilePrefetcher prefetcher(inA, inB, n, tileSize, localStats);
+    for (size_t s = 0; s < steps.size() && ok; s++) {
+        const TileStep& step = steps[s];
+        TilePair& current = buffers[s % 2];
+        TilePair& next = buffers[(s + 1) % 2];
+
+        // Prefetch the next step's tiles on the I/O thread
+        const bool prefetching = s + 1 < steps.size();
+        if (prefetching) prefetcher.request(steps[s + 1], next, current);
+
+        // C(i, j) += A(i, k) * B(k, j) on the resident tiles
+        int rows = std::min(tileSize, n - step.i * tileSize);
+        int cols = std::min(tileSize, n - step.j * tileSize);
+        int depth = std::min(tileSize, n - step.k * tileSize);
+        const long long* a = current.a.data();
+        const long long* b = current.b.data();
+        long long* c = tileC.data();
+        for (int i = 0; i < rows; i++) {
+            for (int k = 0; k < depth; k++) {
+                long long aik = a[static_cast<size_t>(i) * tileSize + k];
+                const long long* bRow = b + static_cast<size_t>(k) * tileSize;
+                long long* cRow = c + static_cast<size_t>(i) * tileSize;
+                for (int j = 0; j < cols; j++) {
+                    cRow[j] += aik * bRow[j];
+                }
+            }
+        }
+
+        // The k loop of this output tile is complete once the next step moves to another tile
+        bool lastStepOfTile = (s + 1 == steps.size()) || steps[s + 1].i != step.i || steps[s + 1].j != step.j;
+        if (lastStepOfTile) {
+            ok = writeMatrixTile(outC, n, step.i, step.j, tileSize, tileC);
+            localStats.tilesWritten++;
+            std::fill(tileC.begin(), tileC.end(), 0);
+        }
+
+        if (prefetching && !prefetcher.wait()) ok = false;
+    }
+
+    if (stats) *stats = localStats;
+    return ok && static_cast<bool>(outC.flush());
+}
+
+#if defined(__unix__)
+/**
+ * Shared-memory segment used by the multi-process engine.
+ * The header is followed by A, B, C and the two broadcast panels:
+ * panelA (n × panelWidth) and panelB (panelWidth × n).
+ */
+struct SummaSharedHeader {
+    pthread_barrier_t barrier;
+    int n;
+    int gridRows;
+    int gridCols;
+    int panelWidth;
+};
+
+// First row (or column) of block b when n is split into parts nearly equal blocks
+int summaBlockStart(int n, int parts, int b) {
+    return static_cast<int>(static_cast<long long>(n) * b / parts);
+}
+
+/**
+ * Pick a process grid gridRows × gridCols = numProcesses that is as square
+ * as possible, which minimizes the panel data each process receives.
+ */
+void chooseProcessGrid(int numProcesses, int& gridRows, int& gridCols) {
+    gridRows = 1;
+    for (int r = 1; r * r <= numProcesses; r++) {
+        if (numProcesses % r == 0) gridRows = r;
+    }
+    gridCols = numProcesses / gridRows;
+}
+
+/**
+ * Pin the calling worker to one CPU of the allowed set so each rank keeps
+ * its caches and, on multi-socket hosts, its memory node.
+ */
+void pinProcessToCpu(int rank) {
+#if defined(__linux__)
+    cpu_set_t allowed;
+    if (sched_getaffinity(0, sizeof(allowed), &allowed) != 0) return;
+    int count = CPU_COUNT(&allowed);
+    if (count <= 1) return;
+    int target = rank % count;
+    for (int cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+        if (!CPU_ISSET(cpu, &allowed)) continue;
+        if (target-- == 0) {
+            cpu_set_t single;
+            CPU_ZERO(&single);
+            CPU_SET(cpu, &single);
+            sched_setaffinity(0, sizeof(single), &single);
+            return;
+        }
+    }
+#else
+    (void)rank;
+#endif
+}
+
+/**
+ * SUMMA Worker (one process of the grid)
+ * Time Complexity: O(n³ / P) per process
+ * Space Complexity: O(1) private memory; all data lives in the shared segment
+ * 
+ * Algorithm Steps:
+ * 1. Own block (r, c) of A, B and C
+ * 2. For each panel of panelWidth columns of A / rows of B:
+ *    a. Publish the part of the panel that lies in the owned A and B blocks
+ *    b. Barrier: the whole panel is now visible to every process
+ *    c. Update the owned C block with panelA(rows r) × panelB(cols c)
+ *    d. Barrier: nobody overwrites the panel while it is still being read
+ */
+void summaWorker(SummaSharedHeader* header, long long* A, long long* B, long long* C,
+                 long long* panelA, long long* panelB, int rank) {
+    const int n = header->n;
+    const int w = header->panelWidth;
+    const int r = rank / header->gridCols;
+    const int c = rank % header->gridCols;
+    const int rowStart = summaBlockStart(n, header->gridRows, r);
+    const int rowEnd = summaBlockStart(n, header->gridRows, r + 1);
+    const int colStart = summaBlockStart(n, header->gridCols, c);
+    const int colEnd = summaBlockStart(n, header->gridCols, c + 1);
+    // A and B blocks use the same grid as C, so B's row split follows the grid rows
+    const int bRowStart = rowStart, bRowEnd = rowEnd;
+    const int aColStart = colStart, aColEnd = colEnd;
+
+    for (int i = rowStart; i < rowEnd; i++) {
+        for (int j = colStart; j < colEnd; j++) {
+            C[static_cast<size_t>(i) * n + j] = 0;
+        }
+    }
+
+    for (int k0 = 0; k0 < n; k0 += w) {
+        const int k1 = std::min(n, k0 + w);
+
+        // Broadcast: publish the owned slice of this panel
+        for (int i = rowStart; i < rowEnd; i++) {
+            for (int k = std::max(k0, aColStart); k < std::min(k1, aColEnd); k++) {
+                panelA[static_cast<size_t>(i) * w + (k - k0)] = A[static_cast<size_t>(i) * n + k];
+            }
+        }
+        for (int k = std::max(k0, bRowStart); k < std::min(k1, bRowEnd); k++) {
+            std::memcpy(&panelB[static_cast<size_t>(k - k0) * n + colStart], &B[static_cast<size_t>(k) * n + colStart],
+                        static_cast<size_t>(colEnd - colStart) * sizeof(long long));
+        }
+        pthread_barrier_wait(&header->barrier);
+
+        // Local rank-w update of the owned C block
+        for (int i = rowStart; i < rowEnd; i++) {
+            long long* cRow = &C[static_cast<size_t>(i) * n];
+            for (int k = 0; k < k1 - k0; k++) {
+                long long aik = panelA[static_cast<size_t>(i) * w + k];
+                const long long* bRow = &panelB[static_cast<size_t>(k) * n];
+                for (int j = colStart; j < colEnd; j++) {
+                    cRow[j] += aik * bRow[j];
+                }
+            }
+        }
+        pthread_barrier_wait(&header->barrier);
+    }
+}
+
+/**
+ * Multi-Process Shared-Memory Matrix Multiplication (SUMMA)
+ * Time Complexity: O(n³ / P) per process, O(n / panelWidth) synchronization steps
+ * Space Complexity: O(n²) shared, O(1) per process
+ * 
+ * Algorithm Steps:
+ * 1. Create a POSIX shared-memory segment holding A, B, C and the panels
+ * 2. Arrange numProcesses ranks in a near-square grid
+ * 3. Fork one worker per rank into a process group of their own, pin it
+ *    to a CPU and run the SUMMA loop
+ * 4. Reap the group with waitpid; the first worker to exit abnormally
+ *    gets the whole group killed, since the survivors would otherwise wait
+ *    at the barrier forever. Copy C out of the segment if all succeeded
+ * 
+ * Each rank only ever writes its own block of C and its own slice of the
+ * panels, so the same distribution carries over to processes on separate
+ * sockets or nodes with the panel copies replaced by broadcasts.
+ * 
+ * Memory Optimization:
+ * - Workers share one mapping instead of copying operands per process
+ * - The segment is unlinked as soon as it is mapped, so it is freed with
+ *   the last mapping even if a worker crashes; on Linux, workers also get
+ *   SIGKILL if the parent dies, so none is left behind at the barrier
+ */
+bool matrixMultiplySharedMemory(long long** A, long long** B, long long** C, int n,
+                                int numProcesses, int panelWidth = 32) {
+    if (n <= 0 || numProcesses <= 0 || panelWidth <= 0) return false;
+    numProcesses = std::min(numProcesses, n);
+    panelWidth = std::min(panelWidth, n);
+
+    const size_t matrixBytes = static_cast<size_t>(n) * n * sizeof(long long);
+    const size_t panelBytes = static_cast<size_t>(n) * panelWidth * sizeof(long long);
+    const size_t headerBytes = (sizeof(SummaSharedHeader) + 63) / 64 * 64;
+    const size_t totalBytes = headerBytes + 3 * matrixBytes + 2 * panelBytes;
+
+    const std::string name = "/bf_dnc_summa_" + std::to_string(getpid());
+    int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+    if (fd < 0) return false;
+    void* base = MAP_FAILED;
+    if (ftruncate(fd, static_cast<off_t>(totalBytes)) == 0) {
+        base = mmap(nullptr, totalBytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    }
+    close(fd);
+    shm_unlink(name.c_str());
+    if (base == MAP_FAILED) return false;
+
+    char* bytes = static_cast<char*>(base);
+    SummaSharedHeader* header = reinterpret_cast<SummaSharedHeader*>(bytes);
+    long long* sharedA = reinterpret_cast<long long*>(bytes + headerBytes);
+    long long* sharedB = sharedA + static_cast<size_t>(n) * n;
+    long long* sharedC = sharedB + static_cast<size_t>(n) * n;
+    long long* panelA = sharedC + static_cast<size_t>(n) * n;
+    long long* panelB = panelA + static_cast<size_t>(n) * panelWidth;
+
+    header->n = n;
+    header->panelWidth = panelWidth;
+    chooseProcessGrid(numProcesses, header->gridRows, header->gridCols);
+    for (int i = 0; i < n; i++) {
+        std::memcpy(&sharedA[static_cast<size_t>(i) * n], A[i], static_cast<size_t>(n) * sizeof(long long));
+        std::memcpy(&sharedB[static_cast<size_t>(i) * n], B[i], static_cast<size_t>(n) * sizeof(long long));
+    }
+
+    pthread_barrierattr_t attr;
+    pthread_barrierattr_init(&attr);
+    pthread_barrierattr_setpshared(&attr, PTHREAD_PROCESS_SHARED);
+    bool ok = pthread_barrier_init(&header->barrier, &attr, static_cast<unsigned>(numProcesses)) == 0;
+    pthread_barrierattr_destroy(&attr);
+    if (!ok) {
+        munmap(base, totalBytes);
+        return false;
+    }
+
+    // Local launcher: one forked worker per rank, all in the process group of the first
+    pid_t group = 0;
+    int running = 0;
+    for (int rank = 0; rank < numProcesses; rank++) {
+        pid_t pid = fork();
+        if (pid == 0) {
+            setpgid(0, group);
+#if defined(__linux__)
+            prctl(PR_SET_PDEATHSIG, SIGKILL);
+#endif
+            pinProcessToCpu(rank);
+            summaWorker(header, sharedA, sharedB, sharedC, panelA, panelB, rank);
+            _exit(0);
+        }
+        if (pid < 0) {
+            // The barrier can never complete without every rank; stop the ones already started
+            if (group != 0) kill(-group, SIGKILL);
+            ok = false;
+            break;
+        }
+        // Set from both sides so the group exists whichever runs first
+        setpgid(pid, group);
+        if (group == 0) group = pid;
+        running++;
+    }
+    while (running > 0) {
+        int status = 0;
+        const pid_t pid = waitpid(-group, &status, 0);
+        if (pid < 0) {
+            if (errno == EINTR) continue;
+            ok = false;
+            break;
+        }
+        running--;
+        if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+            if (ok) kill(-group, SIGKILL);
+            ok = false;
+        }
+    }
+
+    if (ok) {
+        for (int i = 0; i < n; i++) {
+            std::memcpy(C[i], &sharedC[static_cast<size_t>(i) * n], static_cast<size_t>(n) * sizeof(long long));
+        }
+    }
+    pthread_barrier_destroy(&header->barrier);
+    munmap(base, totalBytes);
+    return ok;
+}
+#endif
+
+/**
+ * Initialization Benchmark
+ * Compares a serial std::mt19937 fill with the counter-based parallel fill
+ * and checks that the parallel fill does not depend on the thread count.
+ */
+void benchmarkInitialization() {
+    std::cout << std::endl << "Testing Matrix Initialization" << std::endl;
+    
+    const int testSizes[] = {512, 2048};
+    const int numTests = sizeof(testSizes) / sizeof(testSizes[0]);
+    const int NUM_ITERATIONS = 3;
+    const unsigned long long SEED = 42;
+    
+    for (int i = 0; i < numTests; i++) {
+        const int n = testSizes[i];
+        std::cout << std::endl << "Test Case " << (i + 1) << ": " << n << "x" << n << " matrix" << std::endl;
+        
+        long long** M1 = allocateMatrix(n);
+        long long** M2 = allocateMatrix(n);
+        
+        // Serial Mersenne Twister fill
+        auto start = std::chrono::high_resolution_clock::now();
+        for (int iter = 0; iter < NUM_ITERATIONS; iter++) {
+            std::mt19937 gen(static_cast<unsigned>(SEED));
+            std::uniform_int_distribution<> dis(1, 10);
+            for (int r = 0; r < n; r++) {
+                for (int c = 0; c < n; c++) {
+                    M1[r][c] = dis(gen);
+                }
+            }
+        }
+        auto end = std::chrono::high_resolution_clock::now();
+        auto durationMT = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start);
+        double avgTimeMT = static_cast<double>(durationMT.count()) / NUM_ITERATIONS;
+        
+        // Counter-based parallel fill
+        start = std::chrono::high_resolution_clock::now();
+        for (int iter = 0; iter < NUM_ITERATIONS; iter++) {
+            initializeRandomMatrix(M1, n, SEED);
+        }
+        end = std::chrono::high_resolution_clock::now();
+        auto durationCB = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start);
+        double avgTimeCB = static_cast<double>(durationCB.count()) / NUM_ITERATIONS;
+        
+        initializeRandomMatrix(M2, n, SEED, 1, 10, 1);
+        bool deterministic = verifyMatrices(M1, M2, n);
+        initializeRandomMatrix(M2, n, SEED, 1, 10, 7);
+        deterministic = deterministic && verifyMatrices(M1, M2, n);
+        
+        std::cout << "Serial mt19937:" << std::endl;
+        std::cout << "Average Time: " << avgTimeMT << " nanoseconds" << std::endl;
+        
+        std::cout << std::endl;
+        
+        std::cout << "Counter-Based Parallel:" << std::endl;
+        std::cout << "Average Time: " << avgTimeCB << " nanoseconds" << std::endl;
+        
+        std::cout << std::endl;
+        
+        std::cout << "Same Result for 1 and 7 Threads: " << (deterministic ? "Yes" : "No") << std::endl;
+        std::cout << "------------------------" << std::endl;
+        
+        freeMatrix(M1);
+        freeMatrix(M2);
+    }
+}
+
+/**
+ * Allocator Benchmark
+ * Reads a large matrix at random positions, which misses the TLB on almost
+ * every access with 4 KB pages, once with per-row heap rows and once with
+ * the huge-page allocator.
+ */
+void benchmarkAllocator() {
+    std::cout << std::endl << "Testing Matrix Allocator" << std::endl;
+    
+    const int testSizes[] = {1024, 2048};
+    const int numTests = sizeof(testSizes) / sizeof(testSizes[0]);
+    const int NUM_ITERATIONS = 3;
+    
+    for (int i = 0; i < numTests; i++) {
+        const int n = testSizes[i];
+        std::cout << std::endl << "Test Case " << (i + 1) << ": " << n << "x" << n << " matrix" << std::endl;
+        
+        long long** heapRows = new long long*[n];
+        for (int r = 0; r < n; r++) {
+            heapRows[r] = new long long[n];
+        }
+        auto start = std::chrono::high_resolution_clock::now();
+        long long** M = allocateMatrix(n);
+        auto end = std::chrono::high_resolution_clock::now();
+        auto durationAlloc = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start);
+        
+        initializeRandomMatrix(M, n, i + 1);
+        for (int r = 0; r < n; r++) {
+            std::memcpy(heapRows[r], M[r], static_cast<size_t>(n) * sizeof(long long));
+        }
+        
+        const long long accesses = static_cast<long long>(n) * n / 4;
+        long long sumHeap = 0, sumHuge = 0;
+        start = std::chrono::high_resolution_clock::now();
+        for (int iter = 0; iter < NUM_ITERATIONS; iter++) {
+            for (long long a = 0; a < accesses; a++) {
+                unsigned long long bits = counterRandom(iter, a);
+                sumHeap += heapRows[bits % n][(bits >> 32) % n];
+            }
+        }
+        end = std::chrono::high_resolution_clock::now();
+        auto durationHeap = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start);
+        double avgTimeHeap = static_cast<double>(durationHeap.count()) / NUM_ITERATIONS;
+        
+        start = std::chrono::high_resolution_clock::now();
+        for (int iter = 0; iter < NUM_ITERATIONS; iter++) {
+            for (long long a = 0; a < accesses; a++) {
+                unsigned long long bits = counterRandom(iter, a);
+                sumHuge += M[bits % n][(bits >> 32) % n];
+            }
+        }
+        end = std::chrono::high_resolution_clock::now();
+        auto durationHuge = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start);
+        double avgTimeHuge = static_cast<double>(durationHuge.count()) / NUM_ITERATIONS;
+        
+        const char* kind = "Heap";
+        if (matrixAllocationKind(M) == MatrixAllocationKind::HugePages) kind = "Explicit Huge Pages";
+        if (matrixAllocationKind(M) == MatrixAllocationKind::TransparentHugePages) kind = "Transparent Huge Pages";
+        
+        std::cout << "Allocation: " << kind << " (" << durationAlloc.count() << " nanoseconds with first touch)" << std::endl;
+        
+        std::cout << std::endl;
+        
+        std::cout << "Per-Row Heap Random Reads:" << std::endl;
+        std::cout << "Average Time: " << avgTimeHeap << " nanoseconds" << std::endl;
+        
+        std::cout << std::endl;
+        
+        std::cout << "Allocator Random Reads:" << std::endl;
+        std::cout << "Average Time: " << avgTimeHuge << " nanoseconds" << std::endl;
+        
+        std::cout << std::endl;
+        
+        std::cout << "Results Match: " << (sumHeap == sumHuge ? "Yes" : "No") << std::endl;
+        std::cout << "------------------------" << std::endl;
+        
+        for (int r = 0; r < n; r++) {
+            delete[] heapRows[r];
+        }
+        delete[] heapRows;
+        freeMatrix(M);
+    }
+}
+
+/**
+ * Out-of-Core Benchmark
+ * Writes A and B to temporary files, multiplies them through the
+ * out-of-core engine and checks the C file against the in-memory result.
+ */
+void benchmarkOutOfCore() {
+    std::cout << std::endl << "Testing Out-of-Core Tiled Multiplication" << std::endl;
+    
+    const int testSizes[] = {100, 256};
+    const int numTests = sizeof(testSizes) / sizeof(testSizes[0]);
+    const int TILE_SIZE = 64;
+    const int NUM_ITERATIONS = 3;
+    const std::filesystem::path dir = std::filesystem::temp_directory_path();
+    const std::string pathA = (dir / "bf_dnc_ooc_a.bin").string();
+    const std::string pathB = (dir / "bf_dnc_ooc_b.bin").string();
+    const std::string pathC = (dir / "bf_dnc_ooc_c.bin").string();
+    
+    for (int i = 0; i < numTests; i++) {
+        const int n = testSizes[i];
+        std::cout << std::endl << "Test Case " << (i + 1) << ": " << n << "x" << n << " matrices, "
+                  << TILE_SIZE << "x" << TILE_SIZE << " tiles" << std::endl;
+        
+        long long** A = allocateMatrix(n);
+        long long** B = allocateMatrix(n);
+        long long** C1 = allocateMatrix(n);
+        long long** C2 = allocateMatrix(n);
+        
+        initializeRandomMatrix(A, n, 2 * i + 1);
+        initializeRandomMatrix(B, n, 2 * i + 2);
+        matrixMultiplyBruteForce(A, B, C1, n);
+        
+        bool ok = writeMatrixFile(pathA, A, n, n) && writeMatrixFile(pathB, B, n, n);
+        
+        OutOfCoreStats stats;
+        auto start = std::chrono::high_resolution_clock::now();
+        for (int iter = 0; iter < NUM_ITERATIONS && ok; iter++) {
+            ok = matrixMultiplyOutOfCore(pathA, pathB, pathC, TILE_SIZE, &stats);
+        }
+        auto end = std::chrono::high_resolution_clock::now();
+        auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start);
+        double avgTime = static_cast<double>(duration.count()) / NUM_ITERATIONS;
+        
+        bool resultsMatch = ok && readMatrixFile(pathC, C2, n, n) && verifyMatrices(C1, C2, n);
+        
+        std::cout << "Out-of-Core:" << std::endl;
+        std::cout << "Average Time: " << avgTime << " nanoseconds" << std::endl;
+        std::cout << "Tiles Read: " << stats.tilesRead << ", Reused: " << stats.tilesReused
+                  << ", Written: " << stats.tilesWritten << std::endl;
+        
+        std::cout << std::endl;
+        
+        std::cout << "Results Match: " << (resultsMatch ? "Yes" : "No") << std::endl;
+        std::cout << "------------------------" << std::endl;
+        
+        freeMatrix(A);
+        freeMatrix(B);
+        freeMatrix(C1);
+        freeMatrix(C2);
+    }
+    
+    std::filesystem::remove(pathA);
+    std::filesystem::remove(pathB);
+    std::filesystem::remove(pathC);
+}
+
+#if defined(__unix__)
+/**
+ * Multi-Process Benchmark
+ * Runs the SUMMA engine with a 2×2 process grid and checks it against
+ * brute force.
+ */
+void benchmarkSharedMemory() {
+    std::cout << std::endl << "Testing Multi-Process Shared-Memory Multiplication" << std::endl;
+    
+    const int testSizes[] = {100, 256};
+    const int numTests = sizeof(testSizes) / sizeof(testSizes[0]);
+    const int NUM_PROCESSES = 4;
+    const int NUM_ITERATIONS = 3;
+    
+    for (int i = 0; i < numTests; i++) {
+        const int n = testSizes[i];
+        std::cout << std::endl << "Test Case " << (i + 1) << ": " << n << "x" << n << " matrices, "
+                  << NUM_PROCESSES << " processes" << std::endl;
+        
+        long long** A = allocateMatrix(n);
+        long long** B = allocateMatrix(n);
+        long long** C1 = allocateMatrix(n);
+        long long** C2 = allocateMatrix(n);
+        
+        initializeRandomMatrix(A, n, 2 * i + 1);
+        initializeRandomMatrix(B, n, 2 * i + 2);
+        matrixMultiplyBruteForce(A, B, C1, n);
+        
+        bool ok = true;
+        auto start = std::chrono::high_resolution_clock::now();
+        for (int iter = 0; iter < NUM_ITERATIONS && ok; iter++) {
+            ok = matrixMultiplySharedMemory(A, B, C2, n, NUM_PROCESSES);
+        }
+        auto end = std::chrono::high_resolution_clock::now();
+        auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start);
+        double avgTime = static_cast<double>(duration.count()) / NUM_ITERATIONS;
+        
+        bool resultsMatch = ok && verifyMatrices(C1, C2, n);
+        
+        std::cout << "Shared-Memory SUMMA:" << std::endl;
+        std::cout << "Average Time: " << avgTime << " nanoseconds" << std::endl;
+        
+        std::cout << std::endl;
+        
+        std::cout << "Results Match: " << (resultsMatch ? "Yes" : "No") << std::endl;
+        std::cout << "------------------------" << std::endl;
+        
+        freeMatrix(A);
+        freeMatrix(B);
+        freeMatrix(C1);
+        freeMatrix(C2);
+    }
+}
+#endif
+
+/**
+ * Matrix-Vector Benchmark
+ * Compares GEMV and the thin-matrix kernel with the previous workaround of
+ * embedding the vector (or k columns) in an n×n matrix for brute force.
+ */
+void benchmarkMatrixVector() {
+    std::cout << std::endl << "Testing Matrix-Vector and Thin-Matrix Multiplication" << std::endl;
+    
+    const int testSizes[] = {256, 512};
+    const int numTests = sizeof(testSizes) / sizeof(testSizes[0]);
+    const int THIN_COLUMNS = 8;
+    const int NUM_ITERATIONS = 3;
+    
+    for (int i = 0; i < numTests; i++) {
+        const int n = testSizes[i];
+        std::cout << std::endl << "Test Case " << (i + 1) << ": " << n << "x" << n << " matrix, "
+                  << THIN_COLUMNS << " right-hand sides" << std::endl;
+        
+        long long** A = allocateMatrix(n);
+        long long** B = allocateMatrix(n);
+        long long** C1 = allocateMatrix(n);
+        long long** thin = allocateMatrix(n, THIN_COLUMNS);
+        long long** C2 = allocateMatrix(n, THIN_COLUMNS);
+        std::vector<long long> x(n), y(n);
+        
+        initializeRandomMatrix(A, n, 2 * i + 1);
+        initializeRandomMatrix(B, n, 2 * i + 2);
+        // Only the first THIN_COLUMNS columns of B are used
+        for (int r = 0; r < n; r++) {
+            for (int c = THIN_COLUMNS; c < n; c++) B[r][c] = 0;
+            for (int c = 0; c < THIN_COLUMNS; c++) thin[r][c] = B[r][c];
+            x[r] = B[r][0];
+        }
+        
+        // Brute force on the padded n×n matrix
+        auto start = std::chrono::high_resolution_clock::now();
+        for (int iter = 0; iter < NUM_ITERATIONS; iter++) {
+            matrixMultiplyBruteForce(A, B, C1, n);
+        }
+        auto end = std::chrono::high_resolution_clock::now();
+        auto durationBF = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start);
+        double avgTimeBF = static_cast<double>(durationBF.count()) / NUM_ITERATIONS;
+        
+        start = std::chrono::high_resolution_clock::now();
+        for (int iter = 0; iter < NUM_ITERATIONS; iter++) {
+            matrixVectorMultiply(A, x.data(), y.data(), n);
+        }
+        end = std::chrono::high_resolution_clock::now();
+        auto durationMV = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start);
+        double avgTimeMV = static_cast<double>(durationMV.count()) / NUM_ITERATIONS;
+        
+        start = std::chrono::high_resolution_clock::now();
+        for (int iter = 0; iter < NUM_ITERATIONS; iter++) {
+            matrixMultiplyThin(A, thin, C2, n, THIN_COLUMNS);
+        }
+        end = std::chrono::high_resolution_clock::now();
+        auto durationThin = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start);
+        double avgTimeThin = static_cast<double>(durationThin.count()) / NUM_ITERATIONS;
+        
+        bool resultsMatch = true;
+        for (int r = 0; r < n; r++) {
+            if (y[r] != C1[r][0]) resultsMatch = false;
+            for (int c = 0; c < THIN_COLUMNS; c++) {
+                if (C2[r][c] != C1[r][c]) resultsMatch = false;
+            }
+        }
+        
+        std::cout << "Brute Force (padded to n×n):" << std::endl;
+        std::cout << "Average Time: " << avgTimeBF << " nanoseconds" << std::endl;
+        
+        std::cout << std::endl;
+        
+        std::cout << "Matrix-Vector:" << std::endl;
+        std::cout << "Average Time: " << avgTimeMV << " nanoseconds" << std::endl;
+        
+        std::cout << std::endl;
+        
+        std::cout << "Thin Matrix (k = " << THIN_COLUMNS << "):" << std::endl;
+        std::cout << "Average Time: " << avgTimeThin << " nanoseconds" << std::endl;
+        
+        std::cout << std::endl;
+        
+        std::cout << "Results Match: " << (resultsMatch ? "Yes" : "No") << std::endl;
+        std::cout << "------------------------" << std::endl;
+        
+        freeMatrix(A);
+        freeMatrix(B);
+        freeMatrix(C1);
+        freeMatrix(thin);
+        freeMatrix(C2);
+    }
+}
+
+/**
+ * Boolean Multiplication Benchmark
+ * Multiplies random 0/1 matrices with brute force on long long (then
+ * reduces each entry to {0, 1}) and with the bit-packed engines, for both
+ * the Boolean semiring and GF(2).
+ */
+void benchmarkBooleanMultiply() {
+    std::cout << std::endl << "Testing Bit-Packed Boolean Multiplication" << std::endl;
+    
+    const int testSizes[] = {256, 512};
+    const int numTests = sizeof(testSizes) / sizeof(testSizes[0]);
+    const double DENSITY = 0.05;
+    const int NUM_ITERATIONS = 3;
+    
+    for (int i = 0; i < numTests; i++) {
+        const int n = testSizes[i];
+        std::cout << std::endl << "Test Case " << (i + 1) << ": " << n << "x" << n << " matrices, density "
+                  << DENSITY << std::endl;
+        
+        long long** A = allocateMatrix(n);
+        long long** B = allocateMatrix(n);
+        long long** C1 = allocateMatrix(n);
+        long long** expectedOr = allocateMatrix(n);
+        long long** expectedXor = allocateMatrix(n);
+        long long** C2 = allocateMatrix(n);
+        
+        initializeSparseMatrix(A, n, 2 * i + 1, DENSITY, 1, 1);
+        initializeSparseMatrix(B, n, 2 * i + 2, DENSITY, 1, 1);
+        
+        auto start = std::chrono::high_resolution_clock::now();
+        for (int iter = 0; iter < NUM_ITERATIONS; iter++) {
+            matrixMultiplyBruteForce(A, B, C1, n);
+        }
+        auto end = std::chrono::high_resolution_clock::now();
+        auto durationBF = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start);
+        double avgTimeBF = static_cast<double>(durationBF.count()) / NUM_ITERATIONS;
+        for (int r = 0; r < n; r++) {
+            for (int c = 0; c < n; c++) {
+                expectedOr[r][c] = C1[r][c] != 0;
+                expectedXor[r][c] = C1[r][c] & 1;
+            }
+        }
+        
+        const BitMatrix packedA = packBooleanMatrix(A, n);
+        const BitMatrix packedB = packBooleanMatrix(B, n);
+        std::cout << "Brute Force (long long):" << std::endl;
+        std::cout << "Average Time: " << avgTimeBF << " nanoseconds" << std::endl;
+        
+        bool resultsMatch = true;
+        const BooleanProduct products[] = {BooleanProduct::Or, BooleanProduct::Xor};
+        for (BooleanProduct product : products) {
+            long long** expected = product == BooleanProduct::Or ? expectedOr : expectedXor;
+            const char* label = product == BooleanProduct::Or ? "AND/OR" : "GF(2)";
+            BitMatrix packedC;
+            
+            start = std::chrono::high_resolution_clock::now();
+            for (int iter = 0; iter < NUM_ITERATIONS; iter++) {
+                packedC = booleanMultiplyPopcount(packedA, packedB, product);
+            }
+            end = std::chrono::high_resolution_clock::now();
+            auto durationPC = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start);
+            double avgTimePC = static_cast<double>(durationPC.count()) / NUM_ITERATIONS;
+            unpackBooleanMatrix(packedC, C2);
+            resultsMatch = resultsMatch && verifyMatrices(expected, C2, n);
+            
+            start = std::chrono::high_resolution_clock::now();
+            for (int iter = 0; iter < NUM_ITERATIONS; iter++) {
+                packedC = booleanMultiplyFourRussians(packedA, packedB, product);
+            }
+            end = std::chrono::high_resolution_clock::now();
+            auto durationFR = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start);
+            double avgTimeFR = static_cast<double>(durationFR.count()) / NUM_ITERATIONS;
+            unpackBooleanMatrix(packedC, C2);
+            resultsMatch = resultsMatch && verifyMatrices(expected, C2, n);
+            
+            std::cout << std::endl;
+            
+            std::cout << "Popcount " << label << ":" << std::endl;
+            std::cout << "Average Time: " << avgTimePC << " nanoseconds" << std::endl;
+            
+            std::cout << std::endl;
+            
+            std::cout << "Four Russians " << label << ":" << std::endl;
+            std::cout << "Average Time: " << avgTimeFR << " nanoseconds" << std::endl;
+        }
+        
+        std::cout << std::endl;
+        
+        std::cout << "Results Match: " << (resultsMatch ? "Yes" : "No") << std::endl;
+        std::cout << "------------------------" << std::endl;
+        
+        freeMatrix(A);
+        freeMatrix(B);
+        freeMatrix(C1);
+        freeMatrix(expectedOr);
+        freeMatrix(expectedXor);
+        freeMatrix(C2);
+    }
+}
+
+/**
+ * Semiring Benchmark
+ * Times the triple loop and the cache-blocked engine for each semiring on
+ * the same inputs: random values for (+, ×), random weighted graphs with
+ * missing edges for min-plus and max-plus, and 0/1 matrices for Boolean.
+ */
+template <typename Semiring>
+void benchmarkSemiringCase(const char* label, long long** A, long long** B, int n, int numIterations) {
+    long long** C1 = allocateMatrix(n);
+    long long** C2 = allocateMatrix(n);
+    
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int iter = 0; iter < numIterations; iter++) {
+        matrixMultiplySemiringNaive<Semiring>(A, B, C1, n);
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    auto durationNaive = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start);
+    double avgTimeNaive = static_cast<double>(durationNaive.count()) / numIterations;
+    
+    start = std::chrono::high_resolution_clock::now();
+    for (int iter = 0; iter < numIterations; iter++) {
+        matrixMultiplySemiring<Semiring>(A, B, C2, n);
+    }
+    end = std::chrono::high_resolution_clock::now();
+    auto durationBlocked = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start);
+    double avgTimeBlocked = static_cast<double>(durationBlocked.count()) / numIterations;
+    
+    std::cout << label << " Triple Loop:" << std::endl;
+    std::cout << "Average Time: " << avgTimeNaive << " nanoseconds" << std::endl;
+    
+    std::cout << std::endl;
+    
+    std::cout << label << " Blocked:" << std::endl;
+    std::cout << "Average Time: " << avgTimeBlocked << " nanoseconds" << std::endl;
+    std::cout << "Results Match: " << (verifyMatrices(C1, C2, n) ? "Yes" : "No") << std::endl;
+    
+    std::cout << std::endl;
+    
+    freeMatrix(C1);
+    freeMatrix(C2);
+}
+
+void benchmarkSemirings() {
+    std::cout << std::endl << "Testing Semiring Matrix Multiplication" << std::endl;
+    
+    const int testSizes[] = {255, 512};
+    const int numTests = sizeof(testSizes) / sizeof(testSizes[0]);
+    const int NUM_ITERATIONS = 3;
+    
+    for (int i = 0; i < numTests; i++) {
+        const int n = testSizes[i];
+        std::cout << std::endl << "Test Case " << (i + 1) << ": " << n << "x" << n << " matrices" << std::endl << std::endl;
+        
+        long long** A = allocateMatrix(n);
+        long long** B = allocateMatrix(n);
+        
+        initializeRandomMatrix(A, n, 2 * i + 1);
+        initializeRandomMatrix(B, n, 2 * i + 2);
+        benchmarkSemiringCase<PlusTimesSemiring>("Plus-Times", A, B, n, NUM_ITERATIONS);
+        
+        // Weighted graphs: 10% of edges present, weights in [1, 100]
+        initializeSparseMatrix(A, n, 2 * i + 1, 0.1, 1, 100);
+        initializeSparseMatrix(B, n, 2 * i + 2, 0.1, 1, 100);
+        for (int r = 0; r < n; r++) {
+            for (int c = 0; c < n; c++) {
+                if (A[r][c] == 0 && r != c) A[r][c] = SEMIRING_INFINITY;
+                if (B[r][c] == 0 && r != c) B[r][c] = SEMIRING_INFINITY;
+            }
+        }
+        benchmarkSemiringCase<MinPlusSemiring>("Min-Plus", A, B, n, NUM_ITERATIONS);
+        
+        for (int r = 0; r < n; r++) {
+            for (int c = 0; c < n; c++) {
+                if (A[r][c] == SEMIRING_INFINITY) A[r][c] = -SEMIRING_INFINITY;
+                if (B[r][c] == SEMIRING_INFINITY) B[r][c] = -SEMIRING_INFINITY;
+            }
+        }
+        benchmarkSemiringCase<MaxPlusSemiring>("Max-Plus", A, B, n, NUM_ITERATIONS);
+        
+        initializeSparseMatrix(A, n, 2 * i + 1, 0.05, 1, 1);
+        initializeSparseMatrix(B, n, 2 * i + 2, 0.05, 1, 1);
+        benchmarkSemiringCase<BooleanSemiring>("Boolean", A, B, n, NUM_ITERATIONS);
+        
+        std::cout << "------------------------" << std::endl;
+        
+        freeMatrix(A);
+        freeMatrix(B);
+    }
+}
+
+/**
+ * All-Pairs Shortest Paths Benchmark
+ * Compares Floyd-Warshall with repeated min-plus squaring on random
+ * weighted graphs and checks every reconstructed path against its distance.
+ */
+void benchmarkShortestPaths() {
+    std::cout << std::endl << "Testing All-Pairs Shortest Paths" << std::endl;
+    
+    const int testSizes[] = {256, 512};
+    const int numTests = sizeof(testSizes) / sizeof(testSizes[0]);
+    const double EDGE_DENSITY = 0.02;
+    const int NUM_ITERATIONS = 3;
+    
+    for (int i = 0; i < numTests; i++) {
+        const int n = testSizes[i];
+        std::cout << std::endl << "Test Case " << (i + 1) << ": " << n << " vertices, edge density "
+                  << EDGE_DENSITY << std::endl;
+        
+        long long** W = allocateMatrix(n);
+        long long** D1 = allocateMatrix(n);
+        long long** D2 = allocateMatrix(n);
+        long long** P = allocateMatrix(n);
+        
+        initializeSparseMatrix(W, n, i + 1, EDGE_DENSITY, 1, 100);
+        for (int r = 0; r < n; r++) {
+            for (int c = 0; c < n; c++) {
+                if (W[r][c] == 0) W[r][c] = SEMIRING_INFINITY;
+            }
+        }
+        
+        auto start = std::chrono::high_resolution_clock::now();
+        for (int iter = 0; iter < NUM_ITERATIONS; iter++) {
+            floydWarshall(W, D1, n);
+        }
+        auto end = std::chrono::high_resolution_clock::now();
+        auto durationFW = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start);
+        double avgTimeFW = static_cast<double>(durationFW.count()) / NUM_ITERATIONS;
+        
+        int squarings = 0;
+        start = std::chrono::high_resolution_clock::now();
+        for (int iter = 0; iter < NUM_ITERATIONS; iter++) {
+            squarings = allPairsShortestPaths(W, D2, P, n);
+        }
+        end = std::chrono::high_resolution_clock::now();
+        auto durationRS = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start);
+        double avgTimeRS = static_cast<double>(durationRS.count()) / NUM_ITERATIONS;
+        
+        bool pathsMatch = true;
+        for (int s = 0; s < n; s++) {
+            for (int t = 0; t < n; t++) {
+                std::vector<int> path = reconstructPath(P, s, t);
+                if (D2[s][t] >= SEMIRING_INFINITY) {
+                    pathsMatch = pathsMatch && path.empty();
+                    continue;
+                }
+                long long length = 0;
+                for (size_t h = 1; h < path.size(); h++) length += W[path[h - 1]][path[h]];
+                pathsMatch = pathsMatch && !path.empty() && length == D2[s][t];
+            }
+        }
+        
+        std::cout << "Floyd-Warshall:" << std::endl;
+        std::cout << "Average Time: " << avgTimeFW << " nanoseconds" << std::endl;
+        
+        std::cout << std::endl;
+        
+        std::cout << "Repeated Min-Plus Squaring (" << squarings << " squarings):" << std::endl;
+        std::cout << "Average Time: " << avgTimeRS << " nanoseconds" << std::endl;
+        
+        std::cout << std::endl;
+        
+        std::cout << "Paths Match Distances: " << (pathsMatch ? "Yes" : "No") << std::endl;
+        std::cout << "Results Match: " << (verifyMatrices(D1, D2, n) ? "Yes" : "No") << std::endl;
+        std::cout << "------------------------" << std::endl;
+        
+        freeMatrix(W);
+        freeMatrix(D1);
+        freeMatrix(D2);
+        freeMatrix(P);
+    }
+    
+    // Small graphs for the edge cases: a negative cycle through every
+    // vertex, and a negative edge next to an unreachable vertex
+    const int m = 3;
+    long long** W = allocateMatrix(m);
+    long long** D = allocateMatrix(m);
+    long long** P = allocateMatrix(m);
+    
+    std::cout << std::endl << "Test Case " << (numTests + 1) << ": negative 3-cycle 0 -> 1 -> 2 -> 0 (weight -3)" << std::endl;
+    fillMatrixParallel(W, m, m, [](int, int) { return SEMIRING_INFINITY; });
+    W[0][1] = -1;
+    W[1][2] = -1;
+    W[2][0] = -1;
+    const int cycleResult = allPairsShortestPaths(W, D, P, m);
+    std::cout << "Results Match: " << (cycleResult == -1 ? "Yes" : "No") << std::endl;
+    std::cout << "------------------------" << std::endl;
+    
+    std::cout << std::endl << "Test Case " << (numTests + 2) << ": negative edge 0 -> 1 (weight -5), vertex 2 unreachable" << std::endl;
+    fillMatrixParallel(W, m, m, [](int, int) { return SEMIRING_INFINITY; });
+    W[0][1] = -5;
+    const int edgeResult = allPairsShortestPaths(W, D, P, m);
+    bool unreachable = edgeResult >= 0 && D[0][1] == -5;
+    for (int r = 0; r < m; r++) unreachable = unreachable && D[r][2] == (r == 2 ? 0 : SEMIRING_INFINITY);
+    floydWarshall(W, P, m);
+    std::cout << "Results Match: " << (unreachable && verifyMatrices(D, P, m) ? "Yes" : "No") << std::endl;
+    std::cout << "------------------------" << std::endl;
+    
+    freeMatrix(W);
+    freeMatrix(D);
+    freeMatrix(P);
+}
+
+/**
+ * Narrow-Element Benchmark
+ * Compares the blocked 64-bit engine with the narrow engine on [1, 10]
+ * inputs (int8 storage) and [-1000, 1000] inputs (int16 storage).
+ */
+void benchmarkNarrowMultiply() {
+    std::cout << std::endl << "Testing Narrow-Element Multiplication" << std::endl;
+    
+    const int testSizes[] = {256, 512};
+    const int numTests = sizeof(testSizes) / sizeof(testSizes[0]);
+    const long long ranges[][2] = {{1, 10}, {-1000, 1000}};
+    const int NUM_ITERATIONS = 3;
+    
+    for (int i = 0; i < numTests; i++) {
+        const int n = testSizes[i];
+        for (const auto& range : ranges) {
+            std::cout << std::endl << "Test Case " << (i + 1) << ": " << n << "x" << n << " matrices, values in ["
+                      << range[0] << ", " << range[1] << "]" << std::endl;
+            
+            long long** A = allocateMatrix(n);
+            long long** B = allocateMatrix(n);
+            long long** C1 = allocateMatrix(n);
+            long long** C2 = allocateMatrix(n);
+            
+            initializeRandomMatrix(A, n, 2 * i + 1, range[0], range[1]);
+            initializeRandomMatrix(B, n, 2 * i + 2, range[0], range[1]);
+            
+            auto start = std::chrono::high_resolution_clock::now();
+            for (int iter = 0; iter < NUM_ITERATIONS; iter++) {
+                matrixMultiplyBlocked(A, B, C1, n);
+            }
+            auto end = std::chrono::high_resolution_clock::now();
+            auto durationBlocked = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start);
+            double avgTimeBlocked = static_cast<double>(durationBlocked.count()) / NUM_ITERATIONS;
+            
+            NarrowElement element = NarrowElement::None;
+            start = std::chrono::high_resolution_clock::now();
+            for (int iter = 0; iter < NUM_ITERATIONS; iter++) {
+                element = matrixMultiplyNarrow(A, B, C2, n);
+            }
+            end = std::chrono::high_resolution_clock::now();
+            auto durationNarrow = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start);
+            double avgTimeNarrow = static_cast<double>(durationNarrow.count()) / NUM_ITERATIONS;
+            
+            const char* storage = element == NarrowElement::Int8 ? "int8" : element == NarrowElement::Int16 ? "int16" : "long long";
+            
+            std::cout << "Blocked (long long):" << std::endl;
+            std::cout << "Average Time: " << avgTimeBlocked << " nanoseconds" << std::endl;
+            
+            std::cout << std::endl;
+            
+            std::cout << "Narrow (" << storage << "):" << std::endl;
+            std::cout << "Average Time: " << avgTimeNarrow << " nanoseconds" << std::endl;
+            
+            std::cout << std::endl;
+            
+            std::cout << "Results Match: " << (verifyMatrices(C1, C2, n) ? "Yes" : "No") << std::endl;
+            std::cout << "------------------------" << std::endl;
+            
+            freeMatrix(A);
+            freeMatrix(B);
+            freeMatrix(C1);
+            freeMatrix(C2);
+        }
+    }
+}
+
+/**
+ * Exact Double Benchmark
+ * Compares the blocked 64-bit engine with the double-precision engine on
+ * [1, 10] inputs, and checks that inputs too large for an exact double
+ * product are routed to the integer engine.
+ */
+void benchmarkExactDouble() {
+    std::cout << std::endl << "Testing Exact Integer Multiplication via Double Precision" << std::endl;
+    std::cout << "FMA Kernel: " << (cpuSupportsFma() ? "AVX2/FMA" : "SSE2") << std::endl;
+    
+    const int testSizes[] = {256, 512};
+    const int numTests = sizeof(testSizes) / sizeof(testSizes[0]);
+    const long long ranges[][2] = {{1, 10}, {-100000000, 100000000}};
+    const int NUM_ITERATIONS = 3;
+    
+    for (int i = 0; i < numTests; i++) {
+        const int n = testSizes[i];
+        for (const auto& range : ranges) {
+            std::cout << std::endl << "Test Case " << (i + 1) << ": " << n << "x" << n << " matrices, values in ["
+                      << range[0] << ", " << range[1] << "]" << std::endl;
+            
+            long long** A = allocateMatrix(n);
+            long long** B = allocateMatrix(n);
+            long long** C1 = allocateMatrix(n);
+            long long** C2 = allocateMatrix(n);
+            
+            initializeRandomMatrix(A, n, 2 * i + 1, range[0], range[1]);
+            initializeRandomMatrix(B, n, 2 * i + 2, range[0], range[1]);
+            
+            auto start = std::chrono::high_resolution_clock::now();
+            for (int iter = 0; iter < NUM_ITERATIONS; iter++) {
+                matrixMultiplyBlocked(A, B, C1, n);
+            }
+            auto end = std::chrono::high_resolution_clock::now();
+            auto durationBlocked = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start);
+            double avgTimeBlocked = static_cast<double>(durationBlocked.count()) / NUM_ITERATIONS;
+            
+            bool usedDouble = false;
+            start = std::chrono::high_resolution_clock::now();
+            for (int iter = 0; iter < NUM_ITERATIONS; iter++) {
+                usedDouble = matrixMultiplyExactDouble(A, B, C2, n);
+            }
+            end = std::chrono::high_resolution_clock::now();
+            auto durationDouble = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start);
+            double avgTimeDouble = static_cast<double>(durationDouble.count()) / NUM_ITERATIONS;
+            
+            std::cout << "Blocked (long long):" << std::endl;
+            std::cout << "Average Time: " << avgTimeBlocked << " nanoseconds" << std::endl;
+            
+            std::cout << std::endl;
+            
+            std::cout << "Exact Double (" << (usedDouble ? "double kernel" : "bound not met, integer fallback") << "):" << std::endl;
+            std::cout << "Average Time: " << avgTimeDouble << " nanoseconds" << std::endl;
+            
+            std::cout << std::endl;
+            
+            std::cout << "Results Match: " << (verifyMatrices(C1, C2, n) ? "Yes" : "No") << std::endl;
+            std::cout << "------------------------" << std::endl;
+            
+            freeMatrix(A);
+            freeMatrix(B);
+            freeMatrix(C1);
+            freeMatrix(C2);
+        }
+    }
+}
+
+/**
+ * Sparse × Dense Benchmark
+ * Compares the blocked engine with CSR SpMM over several densities of A
+ * and reports which engine matrixMultiplyAuto picks.
+ */
+void benchmarkSparseDense() {
+    std::cout << std::endl << "Testing Sparse x Dense Multiplication" << std::endl;
+    
+    const int n = 512;
+    const double densities[] = {0.005, 0.05, 0.2};
+    const int numTests = sizeof(densities) / sizeof(densities[0]);
+    const int NUM_ITERATIONS = 3;
+    
+    for (int i = 0; i < numTests; i++) {
+        const double density = densities[i];
+        std::cout << std::endl << "Test Case " << (i + 1) << ": " << n << "x" << n << " matrices, density of A "
+                  << density << std::endl;
+        
+        long long** A = allocateMatrix(n);
+        long long** B = allocateMatrix(n);
+        long long** C1 = allocateMatrix(n);
+        long long** C2 = allocateMatrix(n);
+        
+        initializeSparseMatrix(A, n, 2 * i + 1, density);
+        initializeRandomMatrix(B, n, 2 * i + 2);
+        
+        auto start = std::chrono::high_resolution_clock::now();
+        for (int iter = 0; iter < NUM_ITERATIONS; iter++) {
+            matrixMultiplyBlocked(A, B, C1, n);
+        }
+        auto end = std::chrono::high_resolution_clock::now();
+        auto durationBlocked = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start);
+        double avgTimeBlocked = static_cast<double>(durationBlocked.count()) / NUM_ITERATIONS;
+        
+        start = std::chrono::high_resolution_clock::now();
+        for (int iter = 0; iter < NUM_ITERATIONS; iter++) {
+            csrDenseMultiply(denseToCsr(A, n, n), B, C2, n);
+        }
+        end = std::chrono::high_resolution_clock::now();
+        auto durationSparse = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start);
+        double avgTimeSparse = static_cast<double>(durationSparse.count()) / NUM_ITERATIONS;
+        bool resultsMatch = verifyMatrices(C1, C2, n);
+        
+        AutoEngine engine = matrixMultiplyAuto(A, B, C2, n);
+        resultsMatch = resultsMatch && verifyMatrices(C1, C2, n);
+        const char* engineName = engine == AutoEngine::Sparse ? "CSR" : engine == AutoEngine::ExactDouble ? "Exact Double" : "Blocked";
+        
+        std::cout << "Blocked:" << std::endl;
+        std::cout << "Average Time: " << avgTimeBlocked << " nanoseconds" << std::endl;
+        
+        std::cout << std::endl;
+        
+        std::cout << "CSR x Dense (including conversion):" << std::endl;
+        std::cout << "Average Time: " << avgTimeSparse << " nanoseconds" << std::endl;
+        
+        std::cout << std::endl;
+        
+        std::cout << "Automatic Choice: " << engineName << std::endl;
+        std::cout << "Results Match: " << (resultsMatch ? "Yes" : "No") << std::endl;
+        std::cout << "------------------------" << std::endl;
+        
+        freeMatrix(A);
+        freeMatrix(B);
+        freeMatrix(C1);
+        freeMatrix(C2);
+    }
+}
+
+/**
+ * Sparse × Sparse Benchmark
+ * Multiplies two sparse matrices through the dense engine and through
+ * SpGEMM, and compares the densified SpGEMM result.
+ */
+void benchmarkSparseSparse() {
+    std::cout << std::endl << "Testing Sparse x Sparse Multiplication" << std::endl;
+    
+    const int testSizes[] = {512, 1024};
+    const int numTests = sizeof(testSizes) / sizeof(testSizes[0]);
+    const double DENSITY = 0.01;
+    const int NUM_ITERATIONS = 3;
+    
+    for (int i = 0; i < numTests; i++) {
+        const int n = testSizes[i];
+        std::cout << std::endl << "Test Case " << (i + 1) << ": " << n << "x" << n << " matrices, density "
+                  << DENSITY << std::endl;
+        
+        long long** A = allocateMatrix(n);
+        long long** B = allocateMatrix(n);
+        long long** C1 = allocateMatrix(n);
+        long long** C2 = allocateMatrix(n);
+        
+        initializeSparseMatrix(A, n, 2 * i + 1, DENSITY);
+        initializeSparseMatrix(B, n, 2 * i + 2, DENSITY);
+        const CsrMatrix sparseA = denseToCsr(A, n, n);
+        const CsrMatrix sparseB = denseToCsr(B, n, n);
+        
+        auto start = std::chrono::high_resolution_clock::now();
+        for (int iter = 0; iter < NUM_ITERATIONS; iter++) {
+            matrixMultiplyExactDouble(A, B, C1, n);
+        }
+        auto end = std::chrono::high_resolution_clock::now();
+        auto durationDense = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start);
+        double avgTimeDense = static_cast<double>(durationDense.count()) / NUM_ITERATIONS;
+        
+        CsrMatrix sparseC;
+        start = std::chrono::high_resolution_clock::now();
+        for (int iter = 0; iter < NUM_ITERATIONS; iter++) {
+            sparseC = csrMultiply(sparseA, sparseB);
+        }
+        end = std::chrono::high_resolution_clock::now();
+        auto durationSparse = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start);
+        double avgTimeSparse = static_cast<double>(durationSparse.count()) / NUM_ITERATIONS;
+        csrToDense(sparseC, C2);
+        
+        std::cout << "Dense (Exact Double):" << std::endl;
+        std::cout << "Average Time: " << avgTimeDense << " nanoseconds" << std::endl;
+        
+        std::cout << std::endl;
+        
+        std::cout << "SpGEMM (" << sparseC.nonZeros() << " nonzeros in C):" << std::endl;
+        std::cout << "Average Time: " << avgTimeSparse << " nanoseconds" << std::endl;
+        
+        std::cout << std::endl;
+        
+        std::cout << "Results Match: " << (verifyMatrices(C1, C2, n) ? "Yes" : "No") << std::endl;
+        std::cout << "------------------------" << std::endl;
+        
+        freeMatrix(A);
+        freeMatrix(B);
+        freeMatrix(C1);
+        freeMatrix(C2);
+    }
+}
+
+/**
+ * Block-Sparse Benchmark
+ * Compares the blocked engine with tile skipping on a dense, a banded and
+ * a block-diagonal matrix A.
+ */
+void benchmarkBlockSparse() {
+    std::cout << std::endl << "Testing Block-Sparse Tile Skipping" << std::endl;
+    
+    const int n = 512;
+    const int BANDWIDTH = 16;
+    const int DIAGONAL_BLOCK = 128;
+    const char* structures[] = {"dense", "banded (bandwidth 16)", "block diagonal (128x128 blocks)"};
+    const int numTests = sizeof(structures) / sizeof(structures[0]);
+    const int NUM_ITERATIONS = 3;
+    
+    for (int i = 0; i < numTests; i++) {
+        std::cout << std::endl << "Test Case " << (i + 1) << ": " << n << "x" << n << " matrices, "
+                  << structures[i] << std::endl;
+        
+        long long** A = allocateMatrix(n);
+        long long** B = allocateMatrix(n);
+        long long** C1 = allocateMatrix(n);
+        long long** C2 = allocateMatrix(n);
+        
+        if (i == 1) {
+            initializeBandedMatrix(A, n, 2 * i + 1, BANDWIDTH);
+            initializeBandedMatrix(B, n, 2 * i + 2, BANDWIDTH);
+        } else {
+            initializeRandomMatrix(A, n, 2 * i + 1);
+            initializeRandomMatrix(B, n, 2 * i + 2);
+        }
+        if (i == 2) {
+            for (int r = 0; r < n; r++) {
+                for (int c = 0; c < n; c++) {
+                    if (r / DIAGONAL_BLOCK != c / DIAGONAL_BLOCK) A[r][c] = 0;
+                }
+            }
+        }
+        
+        auto start = std::chrono::high_resolution_clock::now();
+        for (int iter = 0; iter < NUM_ITERATIONS; iter++) {
+            matrixMultiplyBlocked(A, B, C1, n);
+        }
+        auto end = std::chrono::high_resolution_clock::now();
+        auto durationBlocked = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start);
+        double avgTimeBlocked = static_cast<double>(durationBlocked.count()) / NUM_ITERATIONS;
+        
+        start = std::chrono::high_resolution_clock::now();
+        for (int iter = 0; iter < NUM_ITERATIONS; iter++) {
+            matrixMultiplyBlockSparse<PlusTimesSemiring>(A, B, C2, n);
+        }
+        end = std::chrono::high_resolution_clock::now();
+        auto durationSparse = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start);
+        double avgTimeSparse = static_cast<double>(durationSparse.count()) / NUM_ITERATIONS;
+        
+        std::cout << "Blocked:" << std::endl;
+        std::cout << "Average Time: " << avgTimeBlocked << " nanoseconds" << std::endl;
+        
+        std::cout << std::endl;
+        
+        std::cout << "Block-Sparse:" << std::endl;
+        std::cout << "Average Time: " << avgTimeSparse << " nanoseconds" << std::endl;
+        
+        std::cout << std::endl;
+        
+        std::cout << "Results Match: " << (verifyMatrices(C1, C2, n) ? "Yes" : "No") << std::endl;
+        std::cout << "------------------------" << std::endl;
+        
+        freeMatrix(A);
+        freeMatrix(B);
+        freeMatrix(C1);
+        freeMatrix(C2);
+    }
+    
+    // Max-plus: A only has entries in the first depth block and B a single
+    // one outside it, so nearly every tile product is skipped
+    const int m = 256;
+    std::cout << std::endl << "Test Case " << (numTests + 1) << ": " << m << "x" << m
+              << " max-plus matrices, A in depth block 0, one entry of B outside it" << std::endl;
+    long long** A = allocateMatrix(m);
+    long long** B = allocateMatrix(m);
+    long long** C1 = allocateMatrix(m);
+    long long** C2 = allocateMatrix(m);
+    fillMatrixParallel(A, m, m, [](int r, int c) {
+        return c < SEMIRING_BLOCK_DEPTH ? randomInRange(counterRandom(7, static_cast<unsigned long long>(r) * m + c), 1, 10)
+                                        : -SEMIRING_INFINITY;
+    });
+    fillMatrixParallel(B, m, m, [](int, int) { return -SEMIRING_INFINITY; });
+    B[200][3] = 5;
+    matrixMultiplySemiring<MaxPlusSemiring>(A, B, C1, m);
+    matrixMultiplyBlockSparse<MaxPlusSemiring>(A, B, C2, m);
+    bool noPathStays = true;
+    for (int r = 0; r < m; r++) {
+        for (int c = 0; c < m; c++) noPathStays = noPathStays && C1[r][c] == -SEMIRING_INFINITY;
+    }
+    std::cout << "Results Match: " << (noPathStays && verifyMatrices(C1, C2, m) ? "Yes" : "No") << std::endl;
+    std::cout << "------------------------" << std::endl;
+    freeMatrix(A);
+    freeMatrix(B);
+    freeMatrix(C1);
+    freeMatrix(C2);
+}
+
+/**
+ * Triangle Counting Benchmark
+ * Counts triangles of random undirected graphs as trace(A³) / 6 through
+ * the dense engine and with the masked sparse product, and checks the
+ * masked product (A × A) .* A against the dense one.
+ */
+void benchmarkTriangleCounting() {
+    std::cout << std::endl << "Testing Masked Multiplication and Triangle Counting" << std::endl;
+    
+    const int testSizes[] = {256, 512};
+    const int numTests = sizeof(testSizes) / sizeof(testSizes[0]);
+    const double EDGE_DENSITY = 0.05;
+    const int NUM_ITERATIONS = 3;
+    
+    for (int i = 0; i < numTests; i++) {
+        const int n = testSizes[i];
+        std::cout << std::endl << "Test Case " << (i + 1) << ": " << n << " vertices, edge density "
+                  << EDGE_DENSITY << std::endl;
+        
+        long long** A = allocateMatrix(n);
+        long long** A2 = allocateMatrix(n);
+        long long** A3 = allocateMatrix(n);
+        long long** masked = allocateMatrix(n);
+        
+        // Symmetric 0/1 adjacency without self-loops
+        initializeSparseMatrix(A, n, i + 1, EDGE_DENSITY, 1, 1);
+        for (int r = 0; r < n; r++) {
+            A[r][r] = 0;
+            for (int c = 0; c < r; c++) A[r][c] = A[c][r];
+        }
+        const CsrMatrix adjacency = denseToCsr(A, n, n);
+        
+        long long trianglesDense = 0;
+        auto start = std::chrono::high_resolution_clock::now();
+        for (int iter = 0; iter < NUM_ITERATIONS; iter++) {
+            matrixMultiplyExactDouble(A, A, A2, n);
+            matrixMultiplyExactDouble(A2, A, A3, n);
+            long long trace = 0;
+            for (int r = 0; r < n; r++) trace += A3[r][r];
+            trianglesDense = trace / 6;
+        }
+        auto end = std::chrono::high_resolution_clock::now();
+        auto durationDense = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start);
+        double avgTimeDense = static_cast<double>(durationDense.count()) / NUM_ITERATIONS;
+        
+        long long trianglesMasked = 0;
+        start = std::chrono::high_resolution_clock::now();
+        for (int iter = 0; iter < NUM_ITERATIONS; iter++) {
+            trianglesMasked = countTriangles(adjacency);
+        }
+        end = std::chrono::high_resolution_clock::now();
+        auto durationMasked = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start);
+        double avgTimeMasked = static_cast<double>(durationMasked.count()) / NUM_ITERATIONS;
+        
+        // (A × A) .* A, dense and masked
+        csrToDense(csrMaskedMultiply(adjacency, adjacency, adjacency), masked);
+        for (int r = 0; r < n; r++) {
+            for (int c = 0; c < n; c++) A2[r][c] = A[r][c] != 0 ? A2[r][c] : 0;
+        }
+        bool resultsMatch = trianglesDense == trianglesMasked && verifyMatrices(A2, masked, n);
+        
+        std::cout << "Dense trace(A^3) / 6:" << std::endl;
+        std::cout << "Triangles: " << trianglesDense << std::endl;
+        std::cout << "Average Time: " << avgTimeDense << " nanoseconds" << std::endl;
+        
+        std::cout << std::endl;
+        
+        std::cout << "Masked Sparse (L x L) .* L:" << std::endl;
+        std::cout << "Triangles: " << trianglesMasked << std::endl;
+        std::cout << "Average Time: " << avgTimeMasked << " nanoseconds" << std::endl;
+        
+        std::cout << std::endl;
+        
+        std::cout << "Results Match: " << (resultsMatch ? "Yes" : "No") << std::endl;
+        std::cout << "------------------------" << std::endl;
+        
+        freeMatrix(A);
+        freeMatrix(A2);
+        freeMatrix(A3);
+        freeMatrix(masked);
+    }
+}
+
+/**
+ * Transposed Operand Benchmark
+ * Times the cache-oblivious transpose against a plain double loop, then
+ * A^T × B and A × B^T computed with an explicit transpose versus with the
+ * transpose folded into packing.
+ */
+void benchmarkTransposedMultiply() {
+    std::cout << std::endl << "Testing Transpose and Transposed-Operand Multiplication" << std::endl;
+    
+    const int NUM_ITERATIONS = 3;
+    {
+        const int n = 2048;
+        std::cout << std::endl << "Test Case 1: " << n << "x" << n << " transpose" << std::endl;
+        
+        long long** A = allocateMatrix(n);
+        long long** T1 = allocateMatrix(n);
+        long long** T2 = allocateMatrix(n);
+        initializeRandomMatrix(A, n, 1);
+        
+        auto start = std::chrono::high_resolution_clock::now();
+        for (int iter = 0; iter < NUM_ITERATIONS; iter++) {
+            for (int r = 0; r < n; r++) {
+                for (int c = 0; c < n; c++) T1[c][r] = A[r][c];
+            }
+        }
+        auto end = std::chrono::high_resolution_clock::now();
+        auto durationNaive = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start);
+        double avgTimeNaive = static_cast<double>(durationNaive.count()) / NUM_ITERATIONS;
+        
+        start = std::chrono::high_resolution_clock::now();
+        for (int iter = 0; iter < NUM_ITERATIONS; iter++) {
+            transposeMatrix(A, T2, n, n);
+        }
+        end = std::chrono::high_resolution_clock::now();
+        auto durationRecursive = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start);
+        double avgTimeRecursive = static_cast<double>(durationRecursive.count()) / NUM_ITERATIONS;
+        
+        std::cout << "Naive Transpose:" << std::endl;
+        std::cout << "Average Time: " << avgTimeNaive << " nanoseconds" << std::endl;
+        
+        std::cout << std::endl;
+        
+        std::cout << "Cache-Oblivious Transpose:" << std::endl;
+        std::cout << "Average Time: " << avgTimeRecursive << " nanoseconds" << std::endl;
+        
+        std::cout << std::endl;
+        
+        std::cout << "Results Match: " << (verifyMatrices(T1, T2, n) ? "Yes" : "No") << std::endl;
+        std::cout << "------------------------" << std::endl;
+        
+        freeMatrix(A);
+        freeMatrix(T1);
+        freeMatrix(T2);
+    }
+    
+    const int n = 512;
+    const struct {
+        const char* label;
+        Transpose opA;
+        Transpose opB;
+    } cases[] = {
+        {"A^T x B", Transpose::Transposed, Transpose::None},
+        {"A x B^T", Transpose::None, Transpose::Transposed},
+    };
+    int testCase = 2;
+    for (const auto& op : cases) {
+        std::cout << std::endl << "Test Case " << testCase++ << ": " << op.label << ", " << n << "x" << n
+                  << " matrices" << std::endl;
+        
+        long long** A = allocateMatrix(n);
+        long long** B = allocateMatrix(n);
+        long long** T = allocateMatrix(n);
+        long long** C1 = allocateMatrix(n);
+        long long** C2 = allocateMatrix(n);
+        
+        initializeRandomMatrix(A, n, 2 * testCase + 1);
+        initializeRandomMatrix(B, n, 2 * testCase + 2);
+        
+        const bool transposeA = op.opA == Transpose::Transposed;
+        auto start = std::chrono::high_resolution_clock::now();
+        for (int iter = 0; iter < NUM_ITERATIONS; iter++) {
+            transposeMatrix(transposeA ? A : B, T, n, n);
+            matrixMultiplyExactDouble(transposeA ? T : A, transposeA ? B : T, C1, n);
+        }
+        auto end = std::chrono::high_resolution_clock::now();
+        auto durationExplicit = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start);
+        double avgTimeExplicit = static_cast<double>(durationExplicit.count()) / NUM_ITERATIONS;
+        
+        start = std::chrono::high_resolution_clock::now();
+        for (int iter = 0; iter < NUM_ITERATIONS; iter++) {
+            matrixMultiplyExactDouble(A, B, C2, n, op.opA, op.opB);
+        }
+        end = std::chrono::high_resolution_clock::now();
+        auto durationFolded = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start);
+        double avgTimeFolded = static_cast<double>(durationFolded.count()) / NUM_ITERATIONS;
+        
+        std::cout << "Explicit Transpose + Multiply:" << std::endl;
+        std::cout << "Average Time: " << avgTimeExplicit << " nanoseconds" << std::endl;
+        
+        std::cout << std::endl;
+        
+        std::cout << "Transpose Folded into Packing:" << std::endl;
+        std::cout << "Average Time: " << avgTimeFolded << " nanoseconds" << std::endl;
+        
+        std::cout << std::endl;
+        
+        std::cout << "Results Match: " << (verifyMatrices(C1, C2, n) ? "Yes" : "No") << std::endl;
+        std::cout << "------------------------" << std::endl;
+        
+        freeMatrix(A);
+        freeMatrix(B);
+        freeMatrix(T);
+        freeMatrix(C1);
+        freeMatrix(C2);
+    }
+}
+
+/**
+ * Symmetric Rank-k Update Benchmark
+ * Compares A × A^T computed as a general product with the blocked and
+ * Strassen-based SYRK routines, and checks that the unmirrored triangle
+ * leaves the other one untouched.
+ */
+void benchmarkSyrk() {
+    std::cout << std::endl << "Testing Symmetric Rank-k Update (A x A^T)" << std::endl;
+    
+    const int testSizes[] = {256, 512};
+    const int numTests = sizeof(testSizes) / sizeof(testSizes[0]);
+    const int NUM_ITERATIONS = 3;
+    
+    for (int i = 0; i < numTests; i++) {
+        const int n = testSizes[i];
+        std::cout << std::endl << "Test Case " << (i + 1) << ": " << n << "x" << n << " matrices" << std::endl;
+        
+        long long** A = allocateMatrix(n);
+        long long** At = allocateMatrix(n);
+        long long** C1 = allocateMatrix(n);
+        long long** C2 = allocateMatrix(n);
+        long long** C3 = allocateMatrix(n);
+        long long** C4 = allocateMatrix(n);
+        
+        initializeRandomMatrix(A, n, 2 * i + 1);
+        
+        auto start = std::chrono::high_resolution_clock::now();
+        for (int iter = 0; iter < NUM_ITERATIONS; iter++) {
+            transposeMatrix(A, At, n, n);
+            matrixMultiplyBlocked(A, At, C1, n);
+        }
+        auto end = std::chrono::high_resolution_clock::now();
+        auto durationGeneral = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start);
+        double avgTimeGeneral = static_cast<double>(durationGeneral.count()) / NUM_ITERATIONS;
+        
+        start = std::chrono::high_resolution_clock::now();
+        for (int iter = 0; iter < NUM_ITERATIONS; iter++) {
+            matrixMultiplySyrk(A, C2, n);
+        }
+        end = std::chrono::high_resolution_clock::now();
+        auto durationSyrk = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start);
+        double avgTimeSyrk = static_cast<double>(durationSyrk.count()) / NUM_ITERATIONS;
+        
+        start = std::chrono::high_resolution_clock::now();
+        for (int iter = 0; iter < NUM_ITERATIONS; iter++) {
+            matrixMultiplySyrkStrassen(A, C3, n);
+        }
+        end = std::chrono::high_resolution_clock::now();
+        auto durationStrassen = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start);
+        double avgTimeStrassen = static_cast<double>(durationStrassen.count()) / NUM_ITERATIONS;
+        
+        // Upper triangle only: the strict lower triangle must keep its marker
+        for (int r = 0; r < n; r++) std::fill(C4[r], C4[r] + n, -1LL);
+        matrixMultiplySyrk(A, C4, n, Triangle::Upper, false);
+        bool triangleMatch = true;
+        for (int r = 0; r < n; r++) {
+            for (int c = 0; c < n; c++) {
+                if (C4[r][c] != (c >= r ? C1[r][c] : -1)) triangleMatch = false;
+            }
+        }
+        
+        std::cout << "General Blocked A x A^T:" << std::endl;
+        std::cout << "Average Time: " << avgTimeGeneral << " nanoseconds" << std::endl;
+        
+        std::cout << std::endl;
+        
+        std::cout << "Blocked SYRK (lower, mirrored):" << std::endl;
+        std::cout << "Average Time: " << avgTimeSyrk << " nanoseconds" << std::endl;
+        
+        std::cout << std::endl;
+        
+        std::cout << "Strassen SYRK (lower, mirrored):" << std::endl;
+        std::cout << "Average Time: " << avgTimeStrassen << " nanoseconds" << std::endl;
+        
+        std::cout << std::endl;
+        
+        bool resultsMatch = verifyMatrices(C1, C2, n) && verifyMatrices(C1, C3, n) && triangleMatch;
+        std::cout << "Results Match: " << (resultsMatch ? "Yes" : "No") << std::endl;
+        std::cout << "------------------------" << std::endl;
+        
+        freeMatrix(A);
+        freeMatrix(At);
+        freeMatrix(C1);
+        freeMatrix(C2);
+        freeMatrix(C3);
+        freeMatrix(C4);
+    }
+}
+
+/**
+ * Accumulating Multiply Benchmark
+ * Times C = alpha × A × B + beta × C through a temporary product plus an
+ * update pass against the blocked engine's built-in accumulation, then
+ * checks every dense engine's alpha/beta path against the brute-force one.
+ */
+void benchmarkAccumulate() {
+    std::cout << std::endl << "Testing Accumulating Multiplication (C = alpha*A*B + beta*C)" << std::endl;
+    
+    const long long alpha = 3;
+    const long long beta = -2;
+    const int NUM_ITERATIONS = 3;
+    {
+        const int n = 512;
+        std::cout << std::endl << "Test Case 1: " << n << "x" << n << " matrices, alpha = " << alpha
+                  << ", beta = " << beta << std::endl;
+        
+        long long** A = allocateMatrix(n);
+        long long** B = allocateMatrix(n);
+        long long** T = allocateMatrix(n);
+        long long** C1 = allocateMatrix(n);
+        long long** C2 = allocateMatrix(n);
+        
+        initializeRandomMatrix(A, n, 1);
+        initializeRandomMatrix(B, n, 2);
+        initializeRandomMatrix(C1, n, 3);
+        initializeRandomMatrix(C2, n, 3);
+        
+        auto start = std::chrono::high_resolution_clock::now();
+        for (int iter = 0; iter < NUM_ITERATIONS; iter++) {
+            matrixMultiplyBlocked(A, B, T, n);
+            for (int r = 0; r < n; r++) {
+                for (int c = 0; c < n; c++) C1[r][c] = alpha * T[r][c] + beta * C1[r][c];
+            }
+        }
+        auto end = std::chrono::high_resolution_clock::now();
+        auto durationTemporary = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start);
+        double avgTimeTemporary = static_cast<double>(durationTemporary.count()) / NUM_ITERATIONS;
+        
+        start = std::chrono::high_resolution_clock::now();
+        for (int iter = 0; iter < NUM_ITERATIONS; iter++) {
+            matrixMultiplyBlocked(A, B, C2, n, 0, alpha, beta);
+        }
+        end = std::chrono::high_resolution_clock::now();
+        auto durationFused = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start);
+        double avgTimeFused = static_cast<double>(durationFused.count()) / NUM_ITERATIONS;
+        
+        std::cout << "Temporary Product + Update Pass:" << std::endl;
+        std::cout << "Average Time: " << avgTimeTemporary << " nanoseconds" << std::endl;
+        
+        std::cout << std::endl;
+        
+        std::cout << "Blocked with alpha/beta:" << std::endl;
+        std::cout << "Average Time: " << avgTimeFused << " nanoseconds" << std::endl;
+        
+        std::cout << std::endl;
+        
+        std::cout << "Results Match: " << (verifyMatrices(C1, C2, n) ? "Yes" : "No") << std::endl;
+        std::cout << "------------------------" << std::endl;
+        
+        freeMatrix(A);
+        freeMatrix(B);
+        freeMatrix(T);
+        freeMatrix(C1);
+        freeMatrix(C2);
+    }
+    
+    const int n = 128;
+    std::cout << std::endl << "Test Case 2: " << n << "x" << n << " matrices, every engine against brute force" << std::endl;
+    
+    long long** A = allocateMatrix(n);
+    long long** B = allocateMatrix(n);
+    long long** C0 = allocateMatrix(n);
+    long long** expected = allocateMatrix(n);
+    long long** actual = allocateMatrix(n);
+    initializeRandomMatrix(A, n, 4);
+    initializeRandomMatrix(B, n, 5);
+    initializeRandomMatrix(C0, n, 6);
+    
+    auto check = [&](const char* label, long long** reference, const std::function<void(long long**)>& run) {
+        for (int r = 0; r < n; r++) std::copy(C0[r], C0[r] + n, actual[r]);
+        run(actual);
+        std::cout << label << ": " << (verifyMatrices(reference, actual, n) ? "Yes" : "No") << std::endl;
+    };
+    
+    for (int r = 0; r < n; r++) std::copy(C0[r], C0[r] + n, expected[r]);
+    matrixMultiplyBruteForce(A, B, expected, n, alpha, beta);
+    check("Strassen", expected, [&](long long** C) { matrixMultiplyDivideConquer(A, B, C, n, alpha, beta); });
+    check("Blocked", expected, [&](long long** C) { matrixMultiplyBlocked(A, B, C, n, 0, alpha, beta); });
+    check("Exact Double", expected, [&](long long** C) { matrixMultiplyExactDouble(A, B, C, n, 0, alpha, beta); });
+    check("Narrow", expected, [&](long long** C) { matrixMultiplyNarrow(A, B, C, n, 0, alpha, beta); });
+    check("CSR x Dense", expected, [&](long long** C) { csrDenseMultiply(denseToCsr(A, n, n), B, C, n, 0, alpha, beta); });
+    check("Auto", expected, [&](long long** C) { matrixMultiplyAuto(A, B, C, n, 0, alpha, beta); });
+    check("Thin (full width)", expected, [&](long long** C) { matrixMultiplyThin(A, B, C, n, n, 0, alpha, beta); });
+    
+    // Symmetric engines: C = alpha × A × A^T + beta × C, C symmetric
+    for (int r = 0; r < n; r++) {
+        for (int c = 0; c < r; c++) C0[r][c] = C0[c][r];
+    }
+    long long** At = allocateMatrix(n);
+    transposeMatrix(A, At, n, n);
+    for (int r = 0; r < n; r++) std::copy(C0[r], C0[r] + n, expected[r]);
+    matrixMultiplyBruteForce(A, At, expected, n, alpha, beta);
+    check("SYRK", expected, [&](long long** C) { matrixMultiplySyrk(A, C, n, Triangle::Lower, true, 0, alpha, beta); });
+    std::cout << "------------------------" << std::endl;
+    
+    freeMatrix(A);
+    freeMatrix(B);
+    freeMatrix(At);
+    freeMatrix(C0);
+    freeMatrix(expected);
+    freeMatrix(actual);
+    
+    // Strassen SYRK only recurses above SYRK_STRASSEN_CUTOFF
+    const int m = 2 * SYRK_STRASSEN_CUTOFF;
+    std::cout << std::endl << "Test Case 3: " << m << "x" << m << " matrices, Strassen SYRK against brute force" << std::endl;
+    long long** S = allocateMatrix(m);
+    long long** St = allocateMatrix(m);
+    long long** D0 = allocateMatrix(m);
+    long long** reference = allocateMatrix(m);
+    long long** result = allocateMatrix(m);
+    initializeRandomMatrix(S, m, 7);
+    initializeRandomMatrix(D0, m, 8);
+    for (int r = 0; r < m; r++) {
+        for (int c = 0; c < r; c++) D0[r][c] = D0[c][r];
+    }
+    transposeMatrix(S, St, m, m);
+    for (int r = 0; r < m; r++) std::copy(D0[r], D0[r] + m, reference[r]);
+    matrixMultiplyBruteForce(S, St, reference, m, alpha, beta);
+    for (Triangle uplo : {Triangle::Lower, Triangle::Upper}) {
+        for (int r = 0; r < m; r++) std::copy(D0[r], D0[r] + m, result[r]);
+        matrixMultiplySyrkStrassen(S, result, m, uplo, true, 0, alpha, beta);
+        std::cout << (uplo == Triangle::Lower ? "Strassen SYRK (lower)" : "Strassen SYRK (upper)") << ": "
+                  << (verifyMatrices(reference, result, m) ? "Yes" : "No") << std::endl;
+    }
+    std::cout << "------------------------" << std::endl;
+    
+    freeMatrix(S);
+    freeMatrix(St);
+    freeMatrix(D0);
+    freeMatrix(reference);
+    freeMatrix(result);
+}
+
+/**
+ * Multiply Planner Benchmark
+ * Prints the plan chosen for several sizes and value ranges and times it
+ * against the exact double engine alone, then checks forced Winograd
+ * levels against the blocked engine.
+ */
+void benchmarkPlanner() {
+    std::cout << std::endl << "Testing Multiply Planner" << std::endl;
+    const CacheSizes caches = detectCacheSizes();
+    std::cout << "Caches: L1 " << caches.l1 / 1024 << " KB, L2 " << caches.l2 / 1024 << " KB, L3 "
+              << caches.l3 / 1024 << " KB" << std::endl;
+    
+    const int testSizes[] = {256, 1024};
+    const int numTests = sizeof(testSizes) / sizeof(testSizes[0]);
+    const long long ranges[][2] = {{1, 10}, {-100000, 100000}};
+    const int NUM_ITERATIONS = 2;
+    int testCase = 1;
+    
+    for (int i = 0; i < numTests; i++) {
+        const int n = testSizes[i];
+        for (const auto& range : ranges) {
+            std::cout << std::endl << "Test Case " << testCase++ << ": " << n << "x" << n << " matrices, values in ["
+                      << range[0] << ", " << range[1] << "]" << std::endl;
+            
+            long long** A = allocateMatrix(n);
+            long long** B = allocateMatrix(n);
+            long long** C1 = allocateMatrix(n);
+            long long** C2 = allocateMatrix(n);
+            
+            initializeRandomMatrix(A, n, 2 * i + 1, range[0], range[1]);
+            initializeRandomMatrix(B, n, 2 * i + 2, range[0], range[1]);
+            
+            auto start = std::chrono::high_resolution_clock::now();
+            for (int iter = 0; iter < NUM_ITERATIONS; iter++) {
+                matrixMultiplyExactDouble(A, B, C1, n);
+            }
+            auto end = std::chrono::high_resolution_clock::now();
+            auto durationDouble = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start);
+            double avgTimeDouble = static_cast<double>(durationDouble.count()) / NUM_ITERATIONS;
+            
+            const MultiplyPlan plan = planMultiply(A, B, n);
+            start = std::chrono::high_resolution_clock::now();
+            for (int iter = 0; iter < NUM_ITERATIONS; iter++) {
+                matrixMultiply(A, B, C2, n);
+            }
+            end = std::chrono::high_resolution_clock::now();
+            auto durationPlanned = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start);
+            double avgTimePlanned = static_cast<double>(durationPlanned.count()) / NUM_ITERATIONS;
+            
+            std::cout << "Exact Double (or its fallback):" << std::endl;
+            std::cout << "Average Time: " << avgTimeDouble << " nanoseconds" << std::endl;
+            
+            std::cout << std::endl;
+            
+            std::cout << "Planned: " << plan.winogradLevels << " Winograd level(s), " << leafKernelName(plan.leafKernel)
+                      << " leaves of " << plan.leafSize << ", depth block " << plan.blockDepth << ", "
+                      << (plan.parallelism == PlanParallelism::AcrossProducts ? "threads across products" : "threads within leaves")
+                      << std::endl;
+            std::cout << "Average Time: " << avgTimePlanned << " nanoseconds" << std::endl;
+            
+            std::cout << std::endl;
+            
+            std::cout << "Results Match: " << (verifyMatrices(C1, C2, n) ? "Yes" : "No") << std::endl;
+            std::cout << "------------------------" << std::endl;
+            
+            freeMatrix(A);
+            freeMatrix(B);
+            freeMatrix(C1);
+            freeMatrix(C2);
+        }
+    }
+    
+    // Forced plans exercise the recursion on sizes the planner keeps flat
+    const int n = 256;
+    std::cout << std::endl << "Test Case " << testCase << ": " << n << "x" << n << " matrices, forced Winograd levels" << std::endl;
+    long long** A = allocateMatrix(n);
+    long long** B = allocateMatrix(n);
+    long long** C1 = allocateMatrix(n);
+    long long** C2 = allocateMatrix(n);
+    initializeRandomMatrix(A, n, 7, -1000, 1000);
+    initializeRandomMatrix(B, n, 8, -1000, 1000);
+    matrixMultiplyBlocked(A, B, C1, n);
+    bool resultsMatch = true;
+    for (int levels = 1; levels <= 3; levels++) {
+        for (PlanParallelism parallelism : {PlanParallelism::WithinLeaves, PlanParallelism::AcrossProducts}) {
+            MultiplyPlan plan = planMultiply(A, B, n);
+            plan.winogradLevels = levels;
+            plan.leafSize = n >> levels;
+            plan.parallelism = parallelism;
+            executePlan(plan, A, B, C2);
+            resultsMatch = resultsMatch && verifyMatrices(C1, C2, n);
+        }
+    }
+    std::cout << "Results Match: " << (resultsMatch ? "Yes" : "No") << std::endl;
+    std::cout << "------------------------" << std::endl;
+    freeMatrix(A);
+    freeMatrix(B);
+    freeMatrix(C1);
+    freeMatrix(C2);
+}
+
+/**
+ * Matrix Chain Benchmark
+ * Multiplies chains of varied shapes left to right and in the order
+ * chosen by the calibrated dynamic program.
+ */
+void benchmarkMatrixChain() {
+    std::cout << std::endl << "Testing Matrix Chain Ordering" << std::endl;
+    const ChainCostModel model = calibrateChainCostModel();
+    std::cout << "Calibrated Model: " << model.perMultiplyAdd * 1e9 << " ns per multiply-add, "
+              << model.perElement * 1e9 << " ns per element" << std::endl;
+    
+    const std::vector<std::vector<int>> chains = {
+        {512, 8, 512, 8, 512, 8, 512},
+        {32, 256, 16, 384, 8, 512, 24, 256, 64},
+    };
+    const int NUM_ITERATIONS = 3;
+    
+    for (size_t c = 0; c < chains.size(); c++) {
+        const std::vector<int>& dims = chains[c];
+        const int count = static_cast<int>(dims.size()) - 1;
+        std::cout << std::endl << "Test Case " << (c + 1) << ": chain of " << count << " matrices, dims";
+        for (int d : dims) std::cout << " " << d;
+        std::cout << std::endl;
+        
+        std::vector<long long**> matrices(count);
+        for (int m = 0; m < count; m++) {
+            matrices[m] = allocateMatrix(dims[m], dims[m + 1]);
+            fillMatrixParallel(matrices[m], dims[m], dims[m + 1], [&](int r, int col) {
+                return randomInRange(counterRandom(m + 1, static_cast<unsigned long long>(r) * dims[m + 1] + col), -3, 3);
+            });
+        }
+        
+        const ChainPlan leftToRight = leftToRightChain(dims, model);
+        const ChainPlan optimal = planMatrixChain(dims, model);
+        
+        long long** C1 = nullptr;
+        auto start = std::chrono::high_resolution_clock::now();
+        for (int iter = 0; iter < NUM_ITERATIONS; iter++) {
+            if (C1) freeMatrix(C1);
+            C1 = multiplyMatrixChain(matrices, dims, leftToRight);
+        }
+        auto end = std::chrono::high_resolution_clock::now();
+        auto durationLeft = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start);
+        double avgTimeLeft = static_cast<double>(durationLeft.count()) / NUM_ITERATIONS;
+        
+        long long** C2 = nullptr;
+        start = std::chrono::high_resolution_clock::now();
+        for (int iter = 0; iter < NUM_ITERATIONS; iter++) {
+            if (C2) freeMatrix(C2);
+            C2 = multiplyMatrixChain(matrices, dims, optimal);
+        }
+        end = std::chrono::high_resolution_clock::now();
+        auto durationOptimal = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start);
+        double avgTimeOptimal = static_cast<double>(durationOptimal.count()) / NUM_ITERATIONS;
+        
+        bool resultsMatch = true;
+        for (int r = 0; r < dims[0]; r++) {
+            for (int col = 0; col < dims[count]; col++) {
+                if (C1[r][col] != C2[r][col]) resultsMatch = false;
+            }
+        }
+        
+        std::cout << "Left to Right " << chainParenthesization(leftToRight, 0, count - 1) << ":" << std::endl;
+        std::cout << "Predicted Time: " << leftToRight.cost * 1e9 << " nanoseconds" << std::endl;
+        std::cout << "Average Time: " << avgTimeLeft << " nanoseconds" << std::endl;
+        
+        std::cout << std::endl;
+        
+        std::cout << "Optimal " << chainParenthesization(optimal, 0, count - 1) << ":" << std::endl;
+        std::cout << "Predicted Time: " << optimal.cost * 1e9 << " nanoseconds" << std::endl;
+        std::cout << "Average Time: " << avgTimeOptimal << " nanoseconds" << std::endl;
+        
+        std::cout << std::endl;
+        
+        std::cout << "Results Match: " << (resultsMatch ? "Yes" : "No") << std::endl;
+        std::cout << "------------------------" << std::endl;
+        
+        for (long long** matrix : matrices) freeMatrix(matrix);
+        freeMatrix(C1);
+        freeMatrix(C2);
+    }
+}
+
+/**
+ * Incremental Product Benchmark
+ * Replays a stream of ticks that each change a few rows of A, a column of
+ * B or apply a rank-2 update, reading the product after every tick, and
+ * compares recomputing from scratch with the maintained product.
+ */
+void benchmarkIncrementalProduct() {
+    std::cout << std::endl << "Testing Incremental Product Maintenance" << std::endl;
+    
+    const int n = 512;
+    const int NUM_TICKS = 8;
+    const int ROWS_PER_TICK = 4;
+    const int RANK = 2;
+    
+    struct Scenario {
+        const char* label;
+        int kind;  // 0: rows of A, 1: column of B, 2: rank-2 update of A
+    };
+    const Scenario scenarios[] = {
+        {"replace 4 rows of A", 0},
+        {"replace 1 column of B", 1},
+        {"rank-2 update of A", 2},
+    };
+    int testCase = 1;
+    for (const Scenario& scenario : scenarios) {
+        std::cout << std::endl << "Test Case " << testCase++ << ": " << n << "x" << n << " matrices, " << NUM_TICKS
+                  << " ticks, " << scenario.label << " per tick" << std::endl;
+        
+        long long** A = allocateMatrix(n);
+        long long** B = allocateMatrix(n);
+        long long** C = allocateMatrix(n);
+        long long** U = allocateMatrix(n, RANK);
+        long long** V = allocateMatrix(RANK, n);
+        std::vector<long long> values(n);
+        initializeRandomMatrix(A, n, 1);
+        initializeRandomMatrix(B, n, 2);
+        MaintainedProduct product = createMaintainedProduct(A, B, n);
+        
+        // Both sides see the same tick stream; the recompute side edits A and B in place
+        unsigned long long counter = 0;
+        auto nextValue = [&]() { return randomInRange(counterRandom(testCase, counter++), 1, 10); };
+        auto applyTick = [&](bool maintained) {
+            if (scenario.kind == 0) {
+                for (int r = 0; r < ROWS_PER_TICK; r++) {
+                    const int row = static_cast<int>(randomInRange(counterRandom(testCase, counter++), 0, n - 1));
+                    for (int j = 0; j < n; j++) values[j] = nextValue();
+                    if (maintained) {
+                        replaceRowA(product, row, values.data());
+                    } else {
+                        std::copy(values.begin(), values.end(), A[row]);
+                    }
+                }
+            } else if (scenario.kind == 1) {
+                const int col = static_cast<int>(randomInRange(counterRandom(testCase, counter++), 0, n - 1));
+                for (int i = 0; i < n; i++) values[i] = nextValue();
+                if (maintained) {
+                    replaceColumnB(product, col, values.data());
+                } else {
+                    for (int i = 0; i < n; i++) B[i][col] = values[i];
+                }
+            } else {
+                for (int i = 0; i < n; i++) {
+                    for (int t = 0; t < RANK; t++) U[i][t] = nextValue() - 5;
+                }
+                for (int t = 0; t < RANK; t++) {
+                    for (int j = 0; j < n; j++) V[t][j] = nextValue() - 5;
+                }
+                if (maintained) {
+                    rankUpdate(product, ProductOperand::A, U, V, RANK);
+                } else {
+                    matrixMultiplyRectangular(U, V, A, n, RANK, n, 0, 1, 1);
+                }
+            }
+        };
+        
+        long long checksum = 0;
+        auto start = std::chrono::high_resolution_clock::now();
+        for (int tick = 0; tick < NUM_TICKS; tick++) {
+            applyTick(false);
+            matrixMultiply(A, B, C, n);
+            checksum += C[tick][tick];
+        }
+        auto end = std::chrono::high_resolution_clock::now();
+        auto durationRecompute = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start);
+        double avgTimeRecompute = static_cast<double>(durationRecompute.count()) / NUM_TICKS;
+        
+        counter = 0;
+        long long maintainedChecksum = 0;
+        start = std::chrono::high_resolution_clock::now();
+        for (int tick = 0; tick < NUM_TICKS; tick++) {
+            applyTick(true);
+            maintainedChecksum += maintainedProduct(product)[tick][tick];
+        }
+        end = std::chrono::high_resolution_clock::now();
+        auto durationMaintained = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start);
+        double avgTimeMaintained = static_cast<double>(durationMaintained.count()) / NUM_TICKS;
+        
+        std::cout << "Recompute per Tick:" << std::endl;
+        std::cout << "Average Time: " << avgTimeRecompute << " nanoseconds" << std::endl;
+        
+        std::cout << std::endl;
+        
+        std::cout << "Maintained Product per Tick:" << std::endl;
+        std::cout << "Average Time: " << avgTimeMaintained << " nanoseconds" << std::endl;
+        
+        std::cout << std::endl;
+        
+        bool resultsMatch = checksum == maintainedChecksum && verifyMatrices(C, maintainedProduct(product), n);
+        std::cout << "Results Match: " << (resultsMatch ? "Yes" : "No") << std::endl;
+        std::cout << "------------------------" << std::endl;
+        
+        destroyMaintainedProduct(product);
+        freeMatrix(A);
+        freeMatrix(B);
+        freeMatrix(C);
+        freeMatrix(U);
+        freeMatrix(V);
+    }
+}
+
+/**
+ * Product Cache Benchmark
+ * Times a miss (hash, multiply, insert), a memory hit, a disk hit and the
+ * hash alone, and checks LRU eviction under a two-product budget.
+ */
+void benchmarkProductCache() {
+    std::cout << std::endl << "Testing Content-Addressed Product Cache" << std::endl;
+    
+    const int n = 512;
+    const size_t productBytes = static_cast<size_t>(n) * n * sizeof(long long);
+    const int NUM_ITERATIONS = 3;
+    const std::filesystem::path dir = std::filesystem::temp_directory_path() / "bf_dnc_product_cache";
+    std::filesystem::remove_all(dir);
+    
+    std::cout << std::endl << "Test Case 1: " << n << "x" << n << " matrices" << std::endl;
+    
+    long long** A = allocateMatrix(n);
+    long long** B = allocateMatrix(n);
+    long long** C1 = allocateMatrix(n);
+    long long** C2 = allocateMatrix(n);
+    long long** C3 = allocateMatrix(n);
+    initializeRandomMatrix(A, n, 1);
+    initializeRandomMatrix(B, n, 2);
+    
+    auto start = std::chrono::high_resolution_clock::now();
+    MatrixDigest digest;
+    for (int iter = 0; iter < NUM_ITERATIONS; iter++) {
+        digest = hashMatrix(A, n, n);
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    double avgTimeHash = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count()) / NUM_ITERATIONS;
+    
+    ProductCache cache(4 * productBytes, dir.string());
+    start = std::chrono::high_resolution_clock::now();
+    matrixMultiplyCached(cache, A, B, C1, n);
+    end = std::chrono::high_resolution_clock::now();
+    double timeMiss = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+    
+    bool allHits = true;
+    start = std::chrono::high_resolution_clock::now();
+    for (int iter = 0; iter < NUM_ITERATIONS; iter++) {
+        allHits = matrixMultiplyCached(cache, A, B, C2, n) && allHits;
+    }
+    end = std::chrono::high_resolution_clock::now();
+    double avgTimeHit = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count()) / NUM_ITERATIONS;
+    
+    // A fresh cache over the same directory only has the disk tier to go on
+    ProductCache diskCache(4 * productBytes, dir.string());
+    start = std::chrono::high_resolution_clock::now();
+    allHits = matrixMultiplyCached(diskCache, A, B, C3, n) && allHits;
+    end = std::chrono::high_resolution_clock::now();
+    double timeDiskHit = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+    
+    bool resultsMatch = allHits && verifyMatrices(C1, C2, n) && verifyMatrices(C1, C3, n) &&
+                        cache.stats().memoryHits == NUM_ITERATIONS && diskCache.stats().diskHits == 1;
+    
+    // One changed element must miss
+    A[n / 2][n / 3]++;
+    resultsMatch = resultsMatch && !(hashMatrix(A, n, n) == digest) && !matrixMultiplyCached(cache, A, B, C3, n);
+    A[n / 2][n / 3]--;
+    
+    std::cout << "Hash of one operand:" << std::endl;
+    std::cout << "Average Time: " << avgTimeHash << " nanoseconds" << std::endl;
+    
+    std::cout << std::endl;
+    
+    std::cout << "Miss (hash, multiply, insert):" << std::endl;
+    std::cout << "Time: " << timeMiss << " nanoseconds" << std::endl;
+    
+    std::cout << std::endl;
+    
+    std::cout << "Memory Hit:" << std::endl;
+    std::cout << "Average Time: " << avgTimeHit << " nanoseconds" << std::endl;
+    
+    std::cout << std::endl;
+    
+    std::cout << "Disk Hit:" << std::endl;
+    std::cout << "Time: " << timeDiskHit << " nanoseconds" << std::endl;
+    
+    std::cout << std::endl;
+    
+    std::cout << "Results Match: " << (resultsMatch ? "Yes" : "No") << std::endl;
+    std::cout << "------------------------" << std::endl;
+    
+    const int m = 64;
+    std::cout << std::endl << "Test Case 2: LRU budget of two " << m << "x" << m << " products" << std::endl;
+    ProductCache small(2 * static_cast<size_t>(m) * m * sizeof(long long));
+    std::vector<long long**> operands;
+    for (int seed = 0; seed < 3; seed++) {
+        operands.push_back(allocateMatrix(m));
+        initializeRandomMatrix(operands.back(), m, 10 + seed);
+    }
+    long long** D = allocateMatrix(m);
+    auto multiplyBlocked = [](long long** a, long long** b, long long** c, int size) { matrixMultiplyBlocked(a, b, c, size); };
+    matrixMultiplyCached(small, "blocked", multiplyBlocked, operands[0], operands[0], D, m);
+    matrixMultiplyCached(small, "blocked", multiplyBlocked, operands[1], operands[1], D, m);
+    matrixMultiplyCached(small, "blocked", multiplyBlocked, operands[0], operands[0], D, m);  // Refresh 0
+    matrixMultiplyCached(small, "blocked", multiplyBlocked, operands[2], operands[2], D, m);  // Evicts 1
+    const bool keptRecent = matrixMultiplyCached(small, "blocked", multiplyBlocked, operands[0], operands[0], D, m);
+    const bool evictedOld = !matrixMultiplyCached(small, "blocked", multiplyBlocked, operands[1], operands[1], D, m);
+    const bool engineKeyed = !matrixMultiplyCached(small, "other", multiplyBlocked, operands[2], operands[2], D, m);
+    std::cout << "Evictions: " << small.stats().evictions << ", memory in use: " << small.memoryBytes() << " bytes" << std::endl;
+    std::cout << "Results Match: " << (keptRecent && evictedOld && engineKeyed ? "Yes" : "No") << std::endl;
+    std::cout << "------------------------" << std::endl;
+    
+    for (long long** operand : operands) freeMatrix(operand);
+    freeMatrix(D);
+    freeMatrix(A);
+    freeMatrix(B);
+    freeMatrix(C1);
+    freeMatrix(C2);
+    freeMatrix(C3);
+    std::filesystem::remove_all(dir);
+}
+
+/**
+ * Benchmark the checkpointed engines: an uninterrupted run, then a run
+ * stopped after a few units and resumed, each checked against the
+ * blocked engine.
+ */
+void benchmarkCheckpoint() {
+    std::cout << std::endl << "Testing Checkpointed Multiplication" << std::endl;
+    
+    const int n = 512;
+    const std::filesystem::path dir = std::filesystem::temp_directory_path() / "bf_dnc_checkpoint";
+    std::filesystem::remove_all(dir);
+    
+    long long** A = allocateMatrix(n);
+    long long** B = allocateMatrix(n);
+    long long** reference = allocateMatrix(n);
+    long long** C = allocateMatrix(n);
+    initializeRandomMatrix(A, n, 1);
+    initializeRandomMatrix(B, n, 2);
+    matrixMultiplyBlocked(A, B, reference, n);
+    
+    using CheckpointedEngine = bool (*)(long long**, long long**, long long**, int, const CheckpointOptions&, CheckpointStats*, int);
+    const std::pair<const char*, CheckpointedEngine> engines[] = {
+        {"Tiled", matrixMultiplyTiledCheckpointed},
+        {"Strassen", matrixMultiplyStrassenCheckpointed},
+    };
+    
+    int testCase = 1;
+    for (const auto& [name, engine] : engines) {
+        std::cout << std::endl << "Test Case " << testCase++ << ": " << name << ", " << n << "x" << n << " matrices" << std::endl;
+        
+        CheckpointOptions options;
+        options.directory = dir.string();
+        options.intervalSeconds = 0;
+        CheckpointStats straight;
+        auto start = std::chrono::high_resolution_clock::now();
+        bool complete = engine(A, B, C, n, options, &straight, 0);
+        auto end = std::chrono::high_resolution_clock::now();
+        double timeStraight = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+        bool resultsMatch = complete && verifyMatrices(reference, C, n) && !std::filesystem::exists(dir);
+        
+        // Preempt after three units, then resume into a cleared C
+        int unitsSeen = 0;
+        options.stopRequested = [&unitsSeen] { return ++unitsSeen >= 3; };
+        CheckpointStats interrupted;
+        const bool stoppedEarly = !engine(A, B, C, n, options, &interrupted, 0);
+        options.stopRequested = nullptr;
+        fillMatrixParallel(C, n, n, [](int, int) { return 0LL; });
+        CheckpointStats resumed;
+        start = std::chrono::high_resolution_clock::now();
+        complete = engine(A, B, C, n, options, &resumed, 0);
+        end = std::chrono::high_resolution_clock::now();
+        double timeResumed = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+        resultsMatch = resultsMatch && stoppedEarly && complete && verifyMatrices(reference, C, n) &&
+                       resumed.unitsResumed == interrupted.unitsComputed &&
+                       resumed.unitsResumed + resumed.unitsComputed == resumed.unitsTotal;
+        
+        std::cout << "Uninterrupted (" << straight.unitsTotal << " units, " << straight.checkpointsWritten << " checkpoints):" << std::endl;
+        std::cout << "Time: " << timeStraight << " nanoseconds" << std::endl;
+        
+        std::cout << std::endl;
+        
+        std::cout << "Resumed (" << resumed.unitsResumed << " units restored, " << resumed.unitsComputed << " computed):" << std::endl;
+        std::cout << "Time: " << timeResumed << " nanoseconds" << std::endl;
+        
+        std::cout << std::endl;
+        
+        std::cout << "Results Match: " << (resultsMatch ? "Yes" : "No") << std::endl;
+        std::cout << "------------------------" << std::endl;
+    }
+    
+    std::filesystem::remove_all(dir);
+    freeMatrix(A);
+    freeMatrix(B);
+    freeMatrix(reference);
+    freeMatrix(C);
+}
+
+/**
+ * Benchmark approximate multiplication against the exact product, on
+ * uniform operands and on operands whose mass sits in a few inner
+ * indices, reporting the achieved Frobenius error next to its bound.
+ */
+void benchmarkApproximateMultiply() {
+    std::cout << std::endl << "Testing Randomized Approximate Multiplication" << std::endl;
+    
+    const int n = 1024;
+    long long** A = allocateMatrix(n);
+    long long** B = allocateMatrix(n);
+    long long** exact = allocateMatrix(n);
+    long long** C = allocateMatrix(n);
+    
+    auto frobenius = [n](long long** M) {
+        double sum = 0.0;
+        for (int i = 0; i < n; i++) {
+            for (int j = 0; j < n; j++) sum += static_cast<double>(M[i][j]) * static_cast<double>(M[i][j]);
+        }
+        return std::sqrt(sum);
+    };
+    
+    struct Operands {
+        const char* name;
+        int heavyEvery;  // Every heavyEvery-th inner index is scaled up (1: uniform)
+    };
+    const Operands operandSets[] = {{"uniform [1, 10]", 1}, {"one inner index in 32 scaled x50", 32}};
+    const std::pair<double, double> targets[] = {{0.2, 0.1}, {0.1, 0.2}};
+    
+    int testCase = 1;
+    for (const Operands& operands : operandSets) {
+        const int heavyEvery = operands.heavyEvery;
+        fillMatrixParallel(A, n, n, [=](int i, int k) {
+            const long long value = randomInRange(counterRandom(1, static_cast<unsigned long long>(i) * n + k), 1, 10);
+            return k % heavyEvery == 0 ? 50 * value : value;
+        });
+        fillMatrixParallel(B, n, n, [=](int k, int j) {
+            const long long value = randomInRange(counterRandom(2, static_cast<unsigned long long>(k) * n + j), 1, 10);
+            return k % heavyEvery == 0 ? 50 * value : value;
+        });
+        auto start = std::chrono::high_resolution_clock::now();
+        matrixMultiply(A, B, exact, n);
+        auto end = std::chrono::high_resolution_clock::now();
+        double timeExact = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+        const double scale = frobenius(A) * frobenius(B);
+        const double exactNorm = frobenius(exact);
+        
+        for (const auto& [epsilon, delta] : targets) {
+            std::cout << std::endl << "Test Case " << testCase++ << ": " << n << "x" << n << ", " << operands.name
+                      << ", epsilon " << epsilon << ", delta " << delta << std::endl;
+            
+            ApproximateOptions options;
+            options.epsilon = epsilon;
+            options.delta = delta;
+            ApproximateStats stats;
+            start = std::chrono::high_resolution_clock::now();
+            matrixMultiplyApproximate(A, B, C, n, options, &stats);
+            end = std::chrono::high_resolution_clock::now();
+            double timeApproximate = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+            
+            double errorSquared = 0.0;
+            for (int i = 0; i < n; i++) {
+                for (int j = 0; j < n; j++) {
+                    const double difference = static_cast<double>(C[i][j] - exact[i][j]);
+                    errorSquared += difference * difference;
+                }
+            }
+            const double error = std::sqrt(errorSquared);
+            
+            std::cout << "Exact (planned):" << std::endl;
+            std::cout << "Time: " << timeExact << " nanoseconds" << std::endl;
+            
+            std::cout << std::endl;
+            
+            std::cout << "Approximate (" << stats.samples << " samples, " << stats.distinctSamples << " distinct"
+                      << (stats.exact ? ", fell back to exact" : "") << "):" << std::endl;
+            std::cout << "Time: " << timeApproximate << " nanoseconds" << std::endl;
+            std::cout << "Error / (||A|| ||B||): " << error / scale << " (target " << epsilon << ")" << std::endl;
+            std::cout << "Error / ||A x B||: " << error / exactNorm << std::endl;
+            
+            std::cout << std::endl;
+            
+            // The bound may fail with probability delta; the seed is fixed, so this is reproducible
+            std::cout << "Results Match: " << (error <= stats.errorBound || stats.exact ? "Yes" : "No") << std::endl;
+            std::cout << "------------------------" << std::endl;
+        }
+    }
+    
+    freeMatrix(A);
+    freeMatrix(B);
+    freeMatrix(exact);
+    freeMatrix(C);
+}
+
+/**
+ * Benchmark divide-and-conquer inversion against Gauss-Jordan, over the
+ * reals and modulo a prime, and the LU solve on a block of right-hand sides.
+ */
+void benchmarkInverseAndSolve() {
+    std::cout << std::endl << "Testing Divide-and-Conquer Inversion and LU Solve" << std::endl;
+    
+    const int n = 512;
+    const RealField real;
+    const PrimeField prime(998244353);
+    
+    // Residual of A × X against the identity (or B), largest absolute entry
+    auto residual = [](double** A, double** X, double** expected, int rows, int cols) {
+        double** product = allocateElementMatrix<double>(rows, cols);
+        RealField().multiplyLeaf(A, X, product, rows, rows, cols, 0);
+        double worst = 0.0;
+        for (int i = 0; i < rows; i++) {
+            for (int j = 0; j < cols; j++) {
+                const double target = expected ? expected[i][j] : (i == j ? 1.0 : 0.0);
+                worst = std::max(worst, std::fabs(product[i][j] - target));
+            }
+        }
+        freeElementMatrix(product);
+        return worst;
+    };
+    
+    std::cout << std::endl << "Test Case 1: " << n << "x" << n << " real matrix, entries in [-10, 10]" << std::endl;
+    double** A = allocateElementMatrix<double>(n, n);
+    double** inverseFast = allocateElementMatrix<double>(n, n);
+    double** inverseNaive = allocateElementMatrix<double>(n, n);
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            A[i][j] = static_cast<double>(randomInRange(counterRandom(1, static_cast<unsigned long long>(i) * n + j), -100, 100)) / 10.0;
+        }
+    }
+    auto start = std::chrono::high_resolution_clock::now();
+    bool regular = invertGaussJordan(real, A, inverseNaive, n);
+    auto end = std::chrono::high_resolution_clock::now();
+    double timeNaive = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+    start = std::chrono::high_resolution_clock::now();
+    regular = matrixInverse(real, A, inverseFast, n) && regular;
+    end = std::chrono::high_resolution_clock::now();
+    double timeFast = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+    const double residualNaive = residual(A, inverseNaive, nullptr, n, n);
+    const double residualFast = residual(A, inverseFast, nullptr, n, n);
+    
+    std::cout << "Gauss-Jordan:" << std::endl;
+    std::cout << "Time: " << timeNaive << " nanoseconds" << std::endl;
+    std::cout << "Max |A x inverse - I|: " << residualNaive << std::endl;
+    
+    std::cout << std::endl;
+    
+    std::cout << "Recursive LU Inversion:" << std::endl;
+    std::cout << "Time: " << timeFast << " nanoseconds" << std::endl;
+    std::cout << "Max |A x inverse - I|: " << residualFast << std::endl;
+    
+    std::cout << std::endl;
+    
+    std::cout << "Results Match: " << (regular && residualFast < 1e-8 ? "Yes" : "No") << std::endl;
+    std::cout << "------------------------" << std::endl;
+    
+    const int rhs = 16;
+    std::cout << std::endl << "Test Case 2: " << n << "x" << n << " real system, " << rhs << " right-hand sides" << std::endl;
+    double** B = allocateElementMatrix<double>(n, rhs);
+    double** X = allocateElementMatrix<double>(n, rhs);
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < rhs; j++) B[i][j] = static_cast<double>(randomInRange(counterRandom(2, static_cast<unsigned long long>(i) * rhs + j), -10, 10));
+    }
+    start = std::chrono::high_resolution_clock::now();
+    regular = matrixSolve(real, A, B, X, n, rhs);
+    end = std::chrono::high_resolution_clock::now();
+    double timeSolve = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+    const double residualSolve = residual(A, X, B, n, rhs);
+    
+    std::cout << "LU Solve:" << std::endl;
+    std::cout << "Time: " << timeSolve << " nanoseconds" << std::endl;
+    std::cout << "Max |A x X - B|: " << residualSolve << std::endl;
+    
+    std::cout << std::endl;
+    
+    std::cout << "Results Match: " << (regular && residualSolve < 1e-8 ? "Yes" : "No") << std::endl;
+    std::cout << "------------------------" << std::endl;
+    
+    std::cout << std::endl << "Test Case 3: " << n << "x" << n << " matrix modulo " << prime.modulus << std::endl;
+    long long** M = allocateElementMatrix<long long>(n, n);
+    long long** modularFast = allocateElementMatrix<long long>(n, n);
+    long long** modularNaive = allocateElementMatrix<long long>(n, n);
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) M[i][j] = randomInRange(counterRandom(3, static_cast<unsigned long long>(i) * n + j), 0, prime.modulus - 1);
+    }
+    start = std::chrono::high_resolution_clock::now();
+    regular = invertGaussJordan(prime, M, modularNaive, n);
+    end = std::chrono::high_resolution_clock::now();
+    timeNaive = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+    start = std::chrono::high_resolution_clock::now();
+    regular = matrixInverse(prime, M, modularFast, n) && regular;
+    end = std::chrono::high_resolution_clock::now();
+    timeFast = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+    bool resultsMatch = regular;
+    for (int i = 0; i < n && resultsMatch; i++) {
+        resultsMatch = std::equal(modularFast[i], modularFast[i] + n, modularNaive[i]);
+    }
+    
+    std::cout << "Gauss-Jordan:" << std::endl;
+    std::cout << "Time: " << timeNaive << " nanoseconds" << std::endl;
+    
+    std::cout << std::endl;
+    
+    std::cout << "Recursive LU Inversion:" << std::endl;
+    std::cout << "Time: " << timeFast << " nanoseconds" << std::endl;
+    
+    std::cout << std::endl;
+    
+    std::cout << "Results Match: " << (resultsMatch ? "Yes" : "No") << std::endl;
+    std::cout << "------------------------" << std::endl;
+    
+    freeElementMatrix(A);
+    freeElementMatrix(inverseFast);
+    freeElementMatrix(inverseNaive);
+    freeElementMatrix(B);
+    freeElementMatrix(X);
+    freeElementMatrix(M);
+    freeElementMatrix(modularFast);
+    freeElementMatrix(modularNaive);
+}
+
+/**
+ * Benchmark exact determinants and ranks: Bareiss against the modular
+ * CRT path where both apply, a determinant far beyond 64 bits checked
+ * modulo an independent prime, and the rank of a known low-rank product.
+ */
+void benchmarkDeterminantAndRank() {
+    std::cout << std::endl << "Testing Exact Determinant and Rank" << std::endl;
+    
+    // Determinant mod q of a decimal string
+    auto decimalModulo = [](const std::string& text, const PrimeField& field) {
+        long long value = 0;
+        for (char digit : text) {
+            if (digit != '-') value = field.add(field.multiply(value, 10), digit - '0');
+        }
+        return text[0] == '-' ? field.subtract(0, value) : value;
+    };
+    
+    const int small = 12;
+    std::cout << std::endl << "Test Case 1: " << small << "x" << small << " matrix, entries in [-10, 10]" << std::endl;
+    long long** A = allocateMatrix(small);
+    initializeRandomMatrix(A, small, 1, -10, 10);
+    long long bareiss = 0;
+    auto start = std::chrono::high_resolution_clock::now();
+    const bool fits = determinantBareiss(A, small, bareiss);
+    auto end = std::chrono::high_resolution_clock::now();
+    double timeBareiss = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+    const std::vector<long long> primes = largePrimes(3);
+    std::vector<long long> residues;
+    start = std::chrono::high_resolution_clock::now();
+    for (long long p : primes) residues.push_back(modularEchelon(PrimeField(p), A, small, small).determinant);
+    const std::string crt = garnerReconstruct(residues, primes);
+    end = std::chrono::high_resolution_clock::now();
+    double timeCrt = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+    
+    std::cout << "Bareiss (__int128):" << std::endl;
+    std::cout << "Time: " << timeBareiss << " nanoseconds" << std::endl;
+    std::cout << "Determinant: " << bareiss << std::endl;
+    
+    std::cout << std::endl;
+    
+    std::cout << "Modular, " << primes.size() << " primes + Garner:" << std::endl;
+    std::cout << "Time: " << timeCrt << " nanoseconds" << std::endl;
+    std::cout << "Determinant: " << crt << std::endl;
+    
+    std::cout << std::endl;
+    
+    std::cout << "Results Match: " << (fits && crt == std::to_string(bareiss) ? "Yes" : "No") << std::endl;
+    std::cout << "------------------------" << std::endl;
+    
+    const int n = 256;
+    std::cout << std::endl << "Test Case 2: " << n << "x" << n << " matrix, entries in [-10, 10]" << std::endl;
+    long long** B = allocateMatrix(n);
+    initializeRandomMatrix(B, n, 2, -10, 10);
+    start = std::chrono::high_resolution_clock::now();
+    const std::string determinant = matrixDeterminant(B, n);
+    end = std::chrono::high_resolution_clock::now();
+    double timeDeterminant = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+    const PrimeField check(998244353);  // Not among the primes matrixDeterminant uses
+    const bool consistent = decimalModulo(determinant, check) == modularEchelon(check, B, n, n).determinant;
+    const size_t digits = determinant.size() - (determinant[0] == '-' ? 1 : 0);
+    
+    std::cout << "Modular CRT Determinant (Hadamard bound 2^" << static_cast<int>(hadamardBoundBits(B, n)) << "):" << std::endl;
+    std::cout << "Time: " << timeDeterminant << " nanoseconds" << std::endl;
+    std::cout << "Determinant: " << digits << " digits, leading " << determinant.substr(0, 12) << "..." << std::endl;
+    
+    std::cout << std::endl;
+    
+    std::cout << "Results Match: " << (consistent ? "Yes" : "No") << std::endl;
+    std::cout << "------------------------" << std::endl;
+    
+    const int inner = 100;
+    std::cout << std::endl << "Test Case 3: rank of a " << n << "x" << n << " product of " << n << "x" << inner
+              << " and " << inner << "x" << n << " factors" << std::endl;
+    long long** U = allocateMatrix(n, inner);
+    long long** V = allocateMatrix(inner, n);
+    long long** P = allocateMatrix(n);
+    fillMatrixParallel(U, n, inner, [=](int i, int j) { return randomInRange(counterRandom(3, static_cast<unsigned long long>(i) * inner + j), -3, 3); });
+    fillMatrixParallel(V, inner, n, [=](int i, int j) { return randomInRange(counterRandom(4, static_cast<unsigned long long>(i) * n + j), -3, 3); });
+    matrixMultiplyRectangular(U, V, P, n, inner, n);
+    start = std::chrono::high_resolution_clock::now();
+    const int rank = matrixRank(P, n, n);
+    end = std::chrono::high_resolution_clock::now();
+    double timeRank = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+    const bool factorsFull = matrixRank(U, n, inner) == inner && matrixRank(V, inner, n) == inner;
+    
+    std::cout << "Modular Blocked Echelon Rank:" << std::endl;
+    std::cout << "Time: " << timeRank << " nanoseconds" << std::endl;
+    std::cout << "Rank: " << rank << std::endl;
+    
+    std::cout << std::endl;
+    
+    std::cout << "Results Match: " << (factorsFull && rank == inner && matrixDeterminant(P, n) == "0" ? "Yes" : "No") << std::endl;
+    std::cout << "------------------------" << std::endl;
+    
+    // Every entry a multiple of the two largest primes below 2^31: both see rank 0
+    const std::vector<long long> multiples = largePrimes(2);
+    std::cout << std::endl << "Test Case 4: rank of " << multiples[0] << " x " << multiples[1] << " x I(2)" << std::endl;
+    long long** D = allocateMatrix(2);
+    D[0][0] = D[1][1] = multiples[0] * multiples[1];
+    const int diagonalRank = matrixRank(D, 2, 2);
+    std::cout << "Rank: " << diagonalRank << std::endl;
+    std::cout << "Results Match: " << (diagonalRank == 2 && matrixDeterminant(D, 2) != "0" ? "Yes" : "No") << std::endl;
+    std::cout << "------------------------" << std::endl;
+    freeMatrix(D);
+    
+    freeMatrix(A);
+    freeMatrix(B);
+    freeMatrix(U);
+    freeMatrix(V);
+    freeMatrix(P);
+}
+
+int main() {
+    std::cout << "Testing Matrix Multiplication Algorithms" << std::endl << std::endl;
+    
+    // Test with different matrix sizes
+    const int testSizes[] = {2, 4, 8, 128};
+    const int numTests = sizeof(testSizes) / sizeof(testSizes[0]);
+    const int NUM_ITERATIONS = 10; // Run each test multiple times
+    
+    for (int i = 0; i < numTests; i++) {
+        const int n = testSizes[i];
+        std::cout << std::endl << "Test Case " << (i + 1) << ": " << n << "x" << n << " matrices" << std::endl;
+        
+        // Allocate matrices
+        long long** A = allocateMatrix(n);
+        long long** B = allocateMatrix(n);
+        long long** C1 = allocateMatrix(n);
+        long long** C2 = allocateMatrix(n);
+        
+        // Initialize test matrices with random values
+        initializeRandomMatrix(A, n, 2 * i + 1);
+        initializeRandomMatrix(B, n, 2 * i + 2);
+        
+        // Measure brute force
+        auto start = std::chrono::high_resolution_clock::now();
+        for (int iter = 0; iter < NUM_ITERATIONS; iter++) {
+            matrixMultiplyBruteForce(A, B, C1, n);
+        }
+        auto end = std::chrono::high_resolution_clock::now();
+        auto durationBF = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start);
+        double avgTimeBF = static_cast<double>(durationBF.count()) / NUM_ITERATIONS;
+        
+        // Measure divide and conquer
+        start = std::chrono::high_resolution_clock::now();
+        for (int iter = 0; iter < NUM_ITERATIONS; iter++) {
+            matrixMultiplyDivideConquer(A, B, C2, n);
+        }
+        end = std::chrono::high_resolution_clock::now();
+        auto durationDC = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start);
+        double avgTimeDC = static_cast<double>(durationDC.count()) / NUM_ITERATIONS;
+        
+        // Verify results
+        bool resultsMatch = verifyMatrices(C1, C2, n);
+        
+        // Print results
+        std::cout << "Brute Force:" << std::endl;
+        std::cout << "Average Time: " << avgTimeBF << " nanoseconds" << std::endl;
+        
+        std::cout << std::endl;
+
+        std::cout << "Divide & Conquer:" << std::endl;
+        std::cout << "Average Time: " << avgTimeDC << " nanoseconds" << std::endl;
+
+        std::cout << std::endl;
+
+        std::cout << "Results Match: " << (resultsMatch ? "Yes" : "No") << std::endl;
+        std::cout << "------------------------" << std::endl;
+        
+        // Clean up
+        freeMatrix(A);
+        freeMatrix(B);
+        freeMatrix(C1);
+        freeMatrix(C2);
+    }
+    
+    benchmarkInitialization();
+    benchmarkAllocator();
+    benchmarkOutOfCore();
+#if defined(__unix__)
+    benchmarkSharedMemory();
+#endif
+    benchmarkMatrixVector();
+    benchmarkBooleanMultiply();
+    benchmarkSemirings();
+    benchmarkShortestPaths();
+    benchmarkNarrowMultiply();
+    benchmarkExactDouble();
+    benchmarkSparseDense();
+    benchmarkSparseSparse();
+    benchmarkBlockSparse();
+    benchmarkTriangleCounting();
+    benchmarkTransposedMultiply();
+    benchmarkSyrk();
+    benchmarkAccumulate();
+    benchmarkPlanner();
+    benchmarkMatrixChain();
+    benchmarkIncrementalProduct();
+    benchmarkProductCache();
+    benchmarkCheckpoint();
+    benchmarkApproximateMultiply();
+    benchmarkInverseAndSolve();
+    benchmarkDeterminantAndRank();
     
     return 0;
 }
\ No newline at end of file